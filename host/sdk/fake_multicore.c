@@ -0,0 +1,143 @@
+/**
+ * @file fake_multicore.c
+ * @brief Host stand-ins for pico/multicore.h on POSIX threads
+ * @version 1.0
+ */
+
+#include <pthread.h>
+#include <string.h>
+#include "host_sdk.h"
+#include "pico/multicore.h"
+
+// ============================================================================
+// STATE
+// ============================================================================
+
+typedef struct {
+    uint32_t word[HOST_FIFO_DEPTH];
+    uint     head;
+    uint     count;
+} fifo_t;
+
+static struct {
+    pthread_mutex_t lock;
+    pthread_cond_t  changed;
+    fifo_t          to_core1;
+    fifo_t          to_core0;
+    pthread_t       thread;
+    bool            launched;
+    bool            reset;          // core1 leaves at its next FIFO access
+    void          (*entry)(void);
+} mc = {
+    .lock    = PTHREAD_MUTEX_INITIALIZER,
+    .changed = PTHREAD_COND_INITIALIZER,
+};
+
+static _Thread_local bool on_core1;
+
+// ============================================================================
+// INTERNAL
+// ============================================================================
+
+// Queue the caller reads from, and the one it writes to
+static fifo_t *rx_fifo(void) { return on_core1 ? &mc.to_core1 : &mc.to_core0; }
+static fifo_t *tx_fifo(void) { return on_core1 ? &mc.to_core0 : &mc.to_core1; }
+
+// A reset core1 stops where it stands, as the real one does
+static void check_reset(void) {
+    if (on_core1 && mc.reset) {
+        pthread_mutex_unlock(&mc.lock);
+        pthread_exit(NULL);
+    }
+}
+
+static void *core1_thread(void *arg) {
+    (void)arg;
+    on_core1 = true;
+    mc.entry();
+    return NULL;
+}
+
+// ============================================================================
+// TEST CONTROL
+// ============================================================================
+
+bool host_multicore_on_core1(void) {
+    return on_core1;
+}
+
+// ============================================================================
+// CORE 1
+// ============================================================================
+
+void multicore_launch_core1(void (*entry)(void)) {
+    multicore_reset_core1();
+
+    pthread_mutex_lock(&mc.lock);
+    memset(&mc.to_core1, 0, sizeof(mc.to_core1));
+    memset(&mc.to_core0, 0, sizeof(mc.to_core0));
+    mc.entry    = entry;
+    mc.reset    = false;
+    mc.launched = true;
+    pthread_mutex_unlock(&mc.lock);
+
+    pthread_create(&mc.thread, NULL, core1_thread, NULL);
+}
+
+void multicore_reset_core1(void) {
+    pthread_mutex_lock(&mc.lock);
+    bool launched = mc.launched;
+    mc.reset    = true;
+    mc.launched = false;
+    pthread_cond_broadcast(&mc.changed);
+    pthread_mutex_unlock(&mc.lock);
+
+    if (launched) pthread_join(mc.thread, NULL);
+}
+
+// ============================================================================
+// FIFO
+// ============================================================================
+
+void multicore_fifo_push_blocking(uint32_t data) {
+    pthread_mutex_lock(&mc.lock);
+    fifo_t *f = tx_fifo();
+    for (;;) {
+        check_reset();
+        if (f->count < HOST_FIFO_DEPTH) break;
+        pthread_cond_wait(&mc.changed, &mc.lock);
+    }
+    f->word[(f->head + f->count++) % HOST_FIFO_DEPTH] = data;
+    pthread_cond_broadcast(&mc.changed);
+    pthread_mutex_unlock(&mc.lock);
+}
+
+uint32_t multicore_fifo_pop_blocking(void) {
+    pthread_mutex_lock(&mc.lock);
+    fifo_t *f = rx_fifo();
+    for (;;) {
+        check_reset();
+        if (f->count) break;
+        pthread_cond_wait(&mc.changed, &mc.lock);
+    }
+    uint32_t data = f->word[f->head];
+    f->head = (f->head + 1) % HOST_FIFO_DEPTH;
+    f->count--;
+    pthread_cond_broadcast(&mc.changed);
+    pthread_mutex_unlock(&mc.lock);
+    return data;
+}
+
+bool multicore_fifo_rvalid(void) {
+    pthread_mutex_lock(&mc.lock);
+    bool valid = rx_fifo()->count > 0;
+    pthread_mutex_unlock(&mc.lock);
+    return valid;
+}
+
+bool multicore_fifo_wready(void) {
+    pthread_mutex_lock(&mc.lock);
+    bool ready = tx_fifo()->count < HOST_FIFO_DEPTH;
+    pthread_mutex_unlock(&mc.lock);
+    return ready;
+}
@@ -0,0 +1,276 @@
+/**
+ * @file fake_sdk.c
+ * @brief Host stand-ins for the Pico SDK calls the display drivers make
+ * @version 1.0
+ */
+
+#include <string.h>
+#include "host_sdk.h"
+#include "hardware/dma.h"
+#include "hardware/gpio.h"
+#include "pico/stdlib.h"
+
+// ============================================================================
+// STATE
+// ============================================================================
+
+static i2c_hw_t i2c0_hw, i2c1_hw;
+
+i2c_inst_t i2c0_inst = { &i2c0_hw, 0 };
+i2c_inst_t i2c1_inst = { &i2c1_hw, 0 };
+
+// DATA_CMD words collected until the one carrying STOP
+typedef struct {
+    uint8_t data[HOST_I2C_TXN_MAX];
+    size_t  len;
+} pending_txn_t;
+
+typedef struct {
+    bool                    claimed;
+    dma_channel_config      config;
+    i2c_inst_t             *i2c;        // Target of the transfer in flight
+    const volatile void    *src;
+    uint                    count;
+    uint                    polls_left; // Busy polls before it completes
+} dma_state_t;
+
+static struct {
+    host_i2c_log_t      log;
+    host_i2c_handler_t  handler;
+    void               *handler_ctx;
+    pending_txn_t       pending[2];
+    dma_state_t         dma[NUM_DMA_CHANNELS];
+    host_dma_log_t      dma_log;
+    uint                dma_latency;
+    absolute_time_t     now_us;
+} sdk;
+
+// ============================================================================
+// INTERNAL
+// ============================================================================
+
+static void reset_hw(i2c_hw_t *hw) {
+    memset((void *)hw, 0, sizeof(*hw));
+    hw->status = I2C_IC_STATUS_TFE_BITS;   // TX FIFO empty, bus idle
+}
+
+// One START..STOP on the bus: log it and let the device answer
+static int complete_txn(i2c_inst_t *i2c, uint8_t addr, const uint8_t *data, size_t len) {
+    host_i2c_log_t *log = &sdk.log;
+
+    log->bytes += (uint32_t)len;
+    log->transactions++;
+    if (log->count < HOST_I2C_LOG_MAX) {
+        host_i2c_txn_t *txn = &log->txn[log->count++];
+        txn->i2c  = i2c;
+        txn->addr = addr;
+        txn->len  = (uint16_t)len;
+        memset(txn->head, 0, sizeof(txn->head));
+        if (len) memcpy(txn->head, data, len < HOST_I2C_HEAD ? len : HOST_I2C_HEAD);
+    }
+
+    if (!sdk.handler) return (int)len;
+    return sdk.handler(sdk.handler_ctx, i2c, addr, data, len);
+}
+
+static i2c_inst_t *i2c_for_data_cmd(volatile void *addr) {
+    if (addr == &i2c0_hw.data_cmd) return i2c0;
+    if (addr == &i2c1_hw.data_cmd) return i2c1;
+    return NULL;
+}
+
+// What the I2C block does with one DATA_CMD word
+static void push_data_cmd(i2c_inst_t *i2c, uint32_t word) {
+    pending_txn_t *p = &sdk.pending[i2c_hw_index(i2c)];
+
+    // TX FIFO held flushed until the abort is cleared
+    if (i2c->hw->raw_intr_stat & I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS) return;
+
+    if (p->len < sizeof(p->data)) p->data[p->len++] = (uint8_t)word;
+    if (!(word & I2C_IC_DATA_CMD_STOP_BITS)) return;
+
+    if (complete_txn(i2c, i2c->address, p->data, p->len) < 0) {
+        i2c->hw->raw_intr_stat |= I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS;
+    }
+    p->len = 0;
+}
+
+static uint32_t read_word(const dma_channel_config *c, const volatile uint8_t *src) {
+    switch (c->size) {
+        case DMA_SIZE_8:  return *src;
+        case DMA_SIZE_16: return *(const volatile uint16_t *)src;
+        default:          return *(const volatile uint32_t *)src;
+    }
+}
+
+// Moves the whole transfer in one go and logs it
+static void complete_dma(uint channel) {
+    dma_state_t *d = &sdk.dma[channel];
+    const volatile uint8_t *src = (const volatile uint8_t *)d->src;
+    int step = d->config.read_increment ? 1 << d->config.size : 0;
+
+    host_dma_transfer_t rec = { channel, d->count, 0, -1, 0 };
+    for (uint i = 0; i < d->count; i++, src += step) {
+        uint32_t word = read_word(&d->config, src);
+        if (i == 0) rec.first = word;
+        if (word & I2C_IC_DATA_CMD_STOP_BITS) {
+            if (rec.stop_at < 0) rec.stop_at = (int)i;
+            rec.stops++;
+        }
+        push_data_cmd(d->i2c, word);
+    }
+    if (sdk.dma_log.count < HOST_DMA_LOG_MAX) sdk.dma_log.transfer[sdk.dma_log.count++] = rec;
+
+    d->i2c = NULL;
+}
+
+// ============================================================================
+// TEST CONTROL
+// ============================================================================
+
+void host_sdk_reset(void) {
+    memset(&sdk, 0, sizeof(sdk));
+    reset_hw(&i2c0_hw);
+    reset_hw(&i2c1_hw);
+    i2c0_inst.address = 0;
+    i2c1_inst.address = 0;
+}
+
+void host_i2c_set_handler(host_i2c_handler_t handler, void *ctx) {
+    sdk.handler     = handler;
+    sdk.handler_ctx = ctx;
+}
+
+void host_i2c_abort(i2c_inst_t *i2c) {
+    sdk.pending[i2c_hw_index(i2c)].len = 0;
+    i2c->hw->raw_intr_stat |= I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS;
+}
+
+void host_dma_set_latency(uint polls) {
+    sdk.dma_latency = polls;
+}
+
+const host_dma_log_t *host_dma_log(void) {
+    return &sdk.dma_log;
+}
+
+const host_i2c_log_t *host_i2c_log(void) {
+    return &sdk.log;
+}
+
+void host_i2c_clear_log(void) {
+    memset(&sdk.log, 0, sizeof(sdk.log));
+}
+
+// ============================================================================
+// I2C
+// ============================================================================
+
+uint i2c_init(i2c_inst_t *i2c, uint baudrate) {
+    reset_hw(i2c->hw);
+    return baudrate;
+}
+
+void i2c_deinit(i2c_inst_t *i2c) {
+    reset_hw(i2c->hw);
+}
+
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop) {
+    (void)nostop;
+    i2c->address = addr;
+    return complete_txn(i2c, addr, src, len) < 0 ? PICO_ERROR_GENERIC : (int)len;
+}
+
+int i2c_read_blocking(i2c_inst_t *i2c, uint8_t addr, uint8_t *dst, size_t len, bool nostop) {
+    (void)nostop;
+    i2c->address = addr;
+    memset(dst, 0, len);
+    return (int)len;
+}
+
+// ============================================================================
+// DMA
+// ============================================================================
+
+int dma_claim_unused_channel(bool required) {
+    (void)required;
+    for (int ch = 0; ch < NUM_DMA_CHANNELS; ch++) {
+        if (sdk.dma[ch].claimed) continue;
+        sdk.dma[ch].claimed = true;
+        return ch;
+    }
+    return -1;
+}
+
+void dma_channel_unclaim(uint channel) {
+    sdk.dma[channel].claimed = false;
+}
+
+dma_channel_config dma_channel_get_default_config(uint channel) {
+    (void)channel;
+    dma_channel_config c = { DMA_SIZE_32, true, false, 0 };
+    return c;
+}
+
+void channel_config_set_transfer_data_size(dma_channel_config *c, enum dma_channel_transfer_size size) {
+    c->size = size;
+}
+
+void channel_config_set_read_increment(dma_channel_config *c, bool incr) {
+    c->read_increment = incr;
+}
+
+void channel_config_set_write_increment(dma_channel_config *c, bool incr) {
+    c->write_increment = incr;
+}
+
+void channel_config_set_dreq(dma_channel_config *c, uint dreq) {
+    c->dreq = dreq;
+}
+
+void dma_channel_configure(uint channel, const dma_channel_config *config,
+                           volatile void *write_addr, const volatile void *read_addr,
+                           uint transfer_count, bool trigger) {
+    dma_state_t *d = &sdk.dma[channel];
+    d->config = *config;
+    if (!trigger) return;
+
+    d->i2c        = i2c_for_data_cmd(write_addr);
+    d->src        = read_addr;
+    d->count      = transfer_count;
+    d->polls_left = sdk.dma_latency;
+    if (!d->i2c) return;
+    if (!d->polls_left) complete_dma(channel);
+}
+
+bool dma_channel_is_busy(uint channel) {
+    dma_state_t *d = &sdk.dma[channel];
+    if (!d->i2c) return false;
+    if (d->polls_left) {
+        d->polls_left--;
+        return true;
+    }
+
+    complete_dma(channel);
+    return false;
+}
+
+void dma_channel_abort(uint channel) {
+    sdk.dma[channel].i2c = NULL;
+}
+
+// ============================================================================
+// GPIO AND TIME
+// ============================================================================
+
+void gpio_init(uint gpio)                                   { (void)gpio; }
+void gpio_set_function(uint gpio, enum gpio_function fn)    { (void)gpio; (void)fn; }
+void gpio_set_dir(uint gpio, bool out)                      { (void)gpio; (void)out; }
+void gpio_put(uint gpio, bool value)                        { (void)gpio; (void)value; }
+void gpio_pull_up(uint gpio)                                { (void)gpio; }
+void gpio_disable_pulls(uint gpio)                          { (void)gpio; }
+
+void sleep_ms(uint32_t ms)              { sdk.now_us += (absolute_time_t)ms * 1000; }
+void sleep_us(uint64_t us)              { sdk.now_us += us; }
+void tight_loop_contents(void)          { }
+absolute_time_t get_absolute_time(void) { return sdk.now_us; }
@@ -0,0 +1,44 @@
+/**
+ * @file dma.h
+ * @brief Host stand-in for hardware/dma.h
+ *
+ * Only transfers into an I2C DATA_CMD register are simulated. The words of
+ * a triggered transfer reach that bus when it completes, at once or after
+ * the latency set with host_dma_set_latency() (host_sdk.h).
+ */
+
+#ifndef HARDWARE_DMA_H
+#define HARDWARE_DMA_H
+
+#include "pico/types.h"
+
+#define NUM_DMA_CHANNELS    12
+
+enum dma_channel_transfer_size {
+    DMA_SIZE_8  = 0,
+    DMA_SIZE_16 = 1,
+    DMA_SIZE_32 = 2,
+};
+
+typedef struct {
+    enum dma_channel_transfer_size size;
+    bool                           read_increment;
+    bool                           write_increment;
+    uint                           dreq;
+} dma_channel_config;
+
+int                dma_claim_unused_channel(bool required);
+void               dma_channel_unclaim(uint channel);
+dma_channel_config dma_channel_get_default_config(uint channel);
+void               channel_config_set_transfer_data_size(dma_channel_config *c,
+                                                         enum dma_channel_transfer_size size);
+void               channel_config_set_read_increment(dma_channel_config *c, bool incr);
+void               channel_config_set_write_increment(dma_channel_config *c, bool incr);
+void               channel_config_set_dreq(dma_channel_config *c, uint dreq);
+void               dma_channel_configure(uint channel, const dma_channel_config *config,
+                                         volatile void *write_addr, const volatile void *read_addr,
+                                         uint transfer_count, bool trigger);
+bool               dma_channel_is_busy(uint channel);
+void               dma_channel_abort(uint channel);
+
+#endif // HARDWARE_DMA_H
@@ -0,0 +1,27 @@
+/**
+ * @file gpio.h
+ * @brief Host stand-in for hardware/gpio.h; pin calls are accepted and ignored
+ */
+
+#ifndef HARDWARE_GPIO_H
+#define HARDWARE_GPIO_H
+
+#include "pico/types.h"
+
+enum gpio_function {
+    GPIO_FUNC_I2C  = 3,
+    GPIO_FUNC_SIO  = 5,
+    GPIO_FUNC_NULL = 0x1f,
+};
+
+#define GPIO_OUT    1
+#define GPIO_IN     0
+
+void gpio_init(uint gpio);
+void gpio_set_function(uint gpio, enum gpio_function fn);
+void gpio_set_dir(uint gpio, bool out);
+void gpio_put(uint gpio, bool value);
+void gpio_pull_up(uint gpio);
+void gpio_disable_pulls(uint gpio);
+
+#endif // HARDWARE_GPIO_H
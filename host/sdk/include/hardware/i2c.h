@@ -0,0 +1,58 @@
+/**
+ * @file i2c.h
+ * @brief Host stand-in for hardware/i2c.h
+ *
+ * Blocking writes go to the handler installed with host_i2c_set_handler()
+ * (host_sdk.h) and into the transaction log. The register block holds only
+ * the registers the drivers touch; DATA_CMD words written by DMA are
+ * collected into one transaction up to the word carrying STOP.
+ */
+
+#ifndef HARDWARE_I2C_H
+#define HARDWARE_I2C_H
+
+#include "pico/types.h"
+
+typedef struct {
+    volatile uint32_t data_cmd;
+    volatile uint32_t status;
+    volatile uint32_t raw_intr_stat;
+    volatile uint32_t clr_tx_abrt;      // Reading it does not clear anything here
+} i2c_hw_t;
+
+typedef struct i2c_inst {
+    i2c_hw_t *hw;
+    uint8_t   address;      // Target of the last blocking write (IC_TAR)
+} i2c_inst_t;
+
+extern i2c_inst_t i2c0_inst;
+extern i2c_inst_t i2c1_inst;
+
+#define i2c0    (&i2c0_inst)
+#define i2c1    (&i2c1_inst)
+
+#define I2C_IC_DATA_CMD_STOP_BITS           0x00000200u
+#define I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS   0x00000040u
+#define I2C_IC_STATUS_TFE_BITS              0x00000004u
+#define I2C_IC_STATUS_MST_ACTIVITY_BITS     0x00000020u
+
+#define PICO_ERROR_GENERIC  (-1)
+
+uint i2c_init(i2c_inst_t *i2c, uint baudrate);
+void i2c_deinit(i2c_inst_t *i2c);
+int  i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop);
+int  i2c_read_blocking(i2c_inst_t *i2c, uint8_t addr, uint8_t *dst, size_t len, bool nostop);
+
+static inline i2c_hw_t *i2c_get_hw(i2c_inst_t *i2c) {
+    return i2c->hw;
+}
+
+static inline uint i2c_hw_index(i2c_inst_t *i2c) {
+    return i2c == i2c1 ? 1u : 0u;
+}
+
+static inline uint i2c_get_dreq(i2c_inst_t *i2c, bool is_tx) {
+    return i2c_hw_index(i2c) * 2u + (is_tx ? 0u : 1u);
+}
+
+#endif // HARDWARE_I2C_H
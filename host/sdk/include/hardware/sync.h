@@ -0,0 +1,15 @@
+/**
+ * @file sync.h
+ * @brief Host stand-in for hardware/sync.h
+ */
+
+#ifndef HARDWARE_SYNC_H
+#define HARDWARE_SYNC_H
+
+#include <stdatomic.h>
+
+static inline void __dmb(void) {
+    atomic_thread_fence(memory_order_seq_cst);
+}
+
+#endif // HARDWARE_SYNC_H
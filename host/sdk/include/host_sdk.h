@@ -0,0 +1,101 @@
+/**
+ * @file host_sdk.h
+ * @brief Control and inspection of the host SDK stand-ins, for tests
+ * @version 1.0
+ *
+ * The drivers build unchanged against the stub headers in this directory.
+ * Everything they put on an I2C bus, by blocking write or by DMA, ends up
+ * here as one transaction per START..STOP: counted, logged, and passed to
+ * an optional handler that can model the device on the other end.
+ */
+
+#ifndef HOST_SDK_H
+#define HOST_SDK_H
+
+#include "pico/types.h"
+#include "hardware/i2c.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// I2C TRANSACTIONS
+// ============================================================================
+
+#define HOST_I2C_LOG_MAX    256     // Transactions kept in the log
+#define HOST_I2C_HEAD       16      // Leading bytes kept of each transaction
+
+// Longest transaction the DMA path can collect (a whole frame + control)
+#define HOST_I2C_TXN_MAX    (1024 + 1)
+
+typedef struct {
+    i2c_inst_t *i2c;
+    uint8_t     addr;
+    uint16_t    len;                // Bytes after the address byte
+    uint8_t     head[HOST_I2C_HEAD];
+} host_i2c_txn_t;
+
+typedef struct {
+    uint32_t       bytes;           // Every transaction, logged or not
+    uint32_t       transactions;
+    uint16_t       count;           // Entries in txn
+    host_i2c_txn_t txn[HOST_I2C_LOG_MAX];
+} host_i2c_log_t;
+
+// Sees each transaction in full. Return len to ACK it, or a negative value
+// to NAK: blocking writes then return PICO_ERROR_GENERIC and DMA writes set
+// TX_ABRT in raw_intr_stat.
+typedef int (*host_i2c_handler_t)(void *ctx, i2c_inst_t *i2c, uint8_t addr,
+                                  const uint8_t *data, size_t len);
+
+// ============================================================================
+// DMA TRANSFERS
+// ============================================================================
+
+#define HOST_DMA_LOG_MAX    32      // Transfers kept in the log
+
+typedef struct {
+    uint     channel;
+    uint     count;                 // Words transferred
+    uint32_t first;                 // First word
+    int      stop_at;               // Index of the first word with STOP, or -1
+    int      stops;                 // Words carrying STOP
+} host_dma_transfer_t;
+
+typedef struct {
+    uint16_t            count;
+    host_dma_transfer_t transfer[HOST_DMA_LOG_MAX];
+} host_dma_log_t;
+
+// ============================================================================
+// FUNCTION DECLARATIONS
+// ============================================================================
+
+// Back to power-on state: empty log, no handler, idle registers, DMA
+// channels free, time zero
+void host_sdk_reset(void);
+
+void                  host_i2c_set_handler(host_i2c_handler_t handler, void *ctx);
+const host_i2c_log_t *host_i2c_log(void);
+void                  host_i2c_clear_log(void);
+
+// Target NAKs the transaction in progress: it is dropped, TX_ABRT is set in
+// raw_intr_stat, and DATA_CMD words are thrown away until the test clears
+// TX_ABRT again (the stand-in cannot see reads of clr_tx_abrt)
+void                  host_i2c_abort(i2c_inst_t *i2c);
+
+// A triggered transfer reports busy for this many dma_channel_is_busy()
+// calls and reaches the bus when it stops being busy. 0 (the default)
+// completes it inside dma_channel_configure().
+void                  host_dma_set_latency(uint polls);
+const host_dma_log_t *host_dma_log(void);
+
+// True on the thread multicore_launch_core1() started (pico/multicore.h)
+bool                  host_multicore_on_core1(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_SDK_H
@@ -0,0 +1,12 @@
+/**
+ * @file binary_info.h
+ * @brief Host stand-in for pico/binary_info.h (nothing to record)
+ */
+
+#ifndef PICO_BINARY_INFO_H
+#define PICO_BINARY_INFO_H
+
+#define bi_decl(...)
+#define bi_2pins_with_func(...)
+
+#endif // PICO_BINARY_INFO_H
@@ -0,0 +1,25 @@
+/**
+ * @file multicore.h
+ * @brief Host stand-in for pico/multicore.h: core1 is a thread
+ *
+ * The inter-core FIFO is two 8-word queues, one per direction, like the
+ * SIO FIFOs. Push and pop pick their queue by the calling thread: the one
+ * started by multicore_launch_core1() is core1, every other thread is core0.
+ */
+
+#ifndef PICO_MULTICORE_H
+#define PICO_MULTICORE_H
+
+#include "pico/types.h"
+
+#define HOST_FIFO_DEPTH 8
+
+void     multicore_launch_core1(void (*entry)(void));
+void     multicore_reset_core1(void);
+
+void     multicore_fifo_push_blocking(uint32_t data);
+uint32_t multicore_fifo_pop_blocking(void);
+bool     multicore_fifo_rvalid(void);
+bool     multicore_fifo_wready(void);
+
+#endif // PICO_MULTICORE_H
@@ -0,0 +1,25 @@
+/**
+ * @file stdlib.h
+ * @brief Host stand-in for pico/stdlib.h: time and the helpers the drivers use
+ *
+ * Time is simulated: it only moves when sleep_ms()/sleep_us() are called.
+ */
+
+#ifndef PICO_STDLIB_H
+#define PICO_STDLIB_H
+
+#include "pico/types.h"
+#include "hardware/gpio.h"
+
+#define count_of(a) (sizeof(a) / sizeof((a)[0]))
+
+void            sleep_ms(uint32_t ms);
+void            sleep_us(uint64_t us);
+void            tight_loop_contents(void);
+absolute_time_t get_absolute_time(void);
+
+static inline uint32_t to_ms_since_boot(absolute_time_t t) {
+    return (uint32_t)(t / 1000);
+}
+
+#endif // PICO_STDLIB_H
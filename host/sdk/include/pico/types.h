@@ -0,0 +1,16 @@
+/**
+ * @file types.h
+ * @brief Host stand-in for pico/types.h
+ */
+
+#ifndef PICO_TYPES_H
+#define PICO_TYPES_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef unsigned int uint;
+typedef uint64_t     absolute_time_t;   // Microseconds since "boot"
+
+#endif // PICO_TYPES_H
@@ -0,0 +1,42 @@
+/**
+ * @file host_test.h
+ * @brief Minimal check macros for the host tests
+ *
+ * A failed check prints where and what, and the test keeps going; main()
+ * returns host_test_result() so ctest sees the failure.
+ */
+
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <stdio.h>
+
+static int host_test_failures;
+
+#define CHECK(cond) do {                                                    \
+    if (!(cond)) {                                                          \
+        printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond);     \
+        host_test_failures++;                                               \
+    }                                                                       \
+} while (0)
+
+#define CHECK_EQ(actual, expected) do {                                     \
+    long long a_ = (long long)(actual), e_ = (long long)(expected);         \
+    if (a_ != e_) {                                                         \
+        printf("%s:%d: %s == %lld, expected %lld\n",                        \
+               __FILE__, __LINE__, #actual, a_, e_);                        \
+        host_test_failures++;                                               \
+    }                                                                       \
+} while (0)
+
+#define RUN(test) do {                                                      \
+    int before_ = host_test_failures;                                       \
+    test();                                                                 \
+    printf("%-40s %s\n", #test, host_test_failures == before_ ? "ok" : "FAILED"); \
+} while (0)
+
+static inline int host_test_result(void) {
+    return host_test_failures ? 1 : 0;
+}
+
+#endif // HOST_TEST_H
@@ -0,0 +1,94 @@
+/**
+ * @file test_oled_flush_budget.c
+ * @brief oled_flush_budget() keeps each call within max_bytes
+ *
+ * Only the first dirty page of a call may exceed the budget, so a caller
+ * such as oled_bus_service() gets a bound on every turn.
+ */
+
+#include <string.h>
+#include "host_test.h"
+#include "oled_core.h"
+
+// Counts the pixel bytes each flush puts on the bus
+static struct {
+    int bytes;
+    int windows;
+} panel;
+
+static void panel_set_window(void *ctx, uint8_t page, uint8_t start_col, uint8_t end_col) {
+    (void)ctx; (void)page; (void)start_col; (void)end_col;
+    panel.windows++;
+}
+
+static void panel_send_data(void *ctx, uint8_t *data, int len) {
+    (void)ctx; (void)data;
+    panel.bytes += len;
+}
+
+static const oled_backend_t panel_backend = {
+    .set_window = panel_set_window,
+    .send_data  = panel_send_data,
+};
+
+static oled_t             gfx;
+static oled_framebuffer_t fb;
+static oled_shadow_t      shadow;
+
+static void setup(bool with_shadow) {
+    memset(&fb, 0, sizeof(fb));
+    oled_bind(&gfx, &panel_backend, NULL);
+    if (with_shadow) oled_set_shadow(&gfx, &shadow);
+    oled_flush(&gfx, &fb);
+    memset(&panel, 0, sizeof(panel));
+}
+
+static void test_first_page_may_exceed_budget(void) {
+    setup(false);
+    oled_fill_rect(&gfx, fb.data, 0, 0, OLED_WIDTH, 16, true);    // Pages 0 and 1
+
+    CHECK_EQ(oled_flush_budget(&gfx, &fb, 16), OLED_WIDTH);
+    CHECK_EQ(panel.bytes, OLED_WIDTH);
+    CHECK(oled_is_dirty(&gfx));
+
+    CHECK_EQ(oled_flush_budget(&gfx, &fb, 16), OLED_WIDTH);
+    CHECK(!oled_is_dirty(&gfx));
+}
+
+static void test_pages_within_budget_share_a_call(void) {
+    setup(false);
+    oled_set_pixel(&gfx, fb.data, 10, 0, true);
+    oled_set_pixel(&gfx, fb.data, 20, 8, true);
+    oled_set_pixel(&gfx, fb.data, 30, 16, true);
+
+    CHECK_EQ(oled_flush_budget(&gfx, &fb, 2), 2);
+    CHECK_EQ(panel.windows, 2);
+    CHECK_EQ(oled_flush_budget(&gfx, &fb, 2), 1);
+    CHECK(!oled_is_dirty(&gfx));
+}
+
+static void test_unchanged_first_page_does_not_lift_budget(void) {
+    setup(true);
+    CHECK(gfx.shadow_valid);
+
+    // Page 0 dirty but identical to the shadow, page 1 a full-width change
+    oled_mark_dirty(&gfx, 0, 0, OLED_WIDTH - 1, 7);
+    oled_fill_rect(&gfx, fb.data, 0, 8, OLED_WIDTH, 8, true);
+
+    // Page 0 used this call's free page; page 1 does not fit in 16 bytes
+    CHECK_EQ(oled_flush_budget(&gfx, &fb, 16), 0);
+    CHECK_EQ(panel.bytes, 0);
+    CHECK(oled_is_dirty(&gfx));
+    CHECK_EQ(gfx.dirty_start[1], 0);
+    CHECK_EQ(gfx.dirty_end[1], OLED_WIDTH - 1);
+
+    CHECK_EQ(oled_flush_budget(&gfx, &fb, 16), OLED_WIDTH);
+    CHECK(!oled_is_dirty(&gfx));
+}
+
+int main(void) {
+    RUN(test_first_page_may_exceed_budget);
+    RUN(test_pages_within_budget_share_a_call);
+    RUN(test_unchanged_first_page_does_not_lift_budget);
+    return host_test_result();
+}
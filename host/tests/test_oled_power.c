@@ -0,0 +1,155 @@
+/**
+ * @file test_oled_power.c
+ * @brief oled_power state walk, and waking from CUT when the panel is dead
+ */
+
+#include <string.h>
+#include "host_sdk.h"
+#include "host_test.h"
+#include "oled_power.h"
+#include "pico/stdlib.h"
+
+// Panel whose init sequence can be made to go unanswered
+static struct {
+    bool    answers;
+    int     inits;
+    uint8_t contrast;
+    bool    on;
+} panel;
+
+static bool panel_init(void *ctx) {
+    (void)ctx;
+    panel.inits++;
+    panel.on = panel.answers;
+    return panel.answers;
+}
+
+static void panel_set_window(void *ctx, uint8_t page, uint8_t start_col, uint8_t end_col) {
+    (void)ctx; (void)page; (void)start_col; (void)end_col;
+}
+
+static void panel_send_data(void *ctx, uint8_t *data, int len) {
+    (void)ctx; (void)data; (void)len;
+}
+
+static void panel_set_contrast(void *ctx, uint8_t contrast) {
+    (void)ctx;
+    panel.contrast = contrast;
+}
+
+static void panel_set_display_on(void *ctx, bool on) {
+    (void)ctx;
+    panel.on = on;
+}
+
+static const oled_backend_t panel_backend = {
+    .init           = panel_init,
+    .set_window     = panel_set_window,
+    .send_data      = panel_send_data,
+    .set_contrast   = panel_set_contrast,
+    .set_display_on = panel_set_display_on,
+};
+
+static oled_t             gfx;
+static oled_power_t       pwr;
+static peripheral_power_t rail;
+
+static void setup(void) {
+    host_sdk_reset();
+    memset(&panel, 0, sizeof(panel));
+    memset(&rail, 0, sizeof(rail));
+    panel.answers = true;
+    panel.on      = true;
+
+    peripheral_power_config_t rail_cfg;
+    peripheral_power_create_config(&rail_cfg, 22, true);
+    peripheral_power_init(&rail, &rail_cfg);
+
+    oled_bind(&gfx, &panel_backend, NULL);
+    oled_clear_dirty(&gfx);
+
+    oled_power_config_t cfg = oled_power_create_config();
+    cfg.dim_ms = 1000;
+    cfg.off_ms = 2000;
+    cfg.cut_ms = 3000;
+    oled_power_init(&pwr, &cfg, &gfx, &rail);
+}
+
+static void idle_until(oled_power_state_t state) {
+    for (int i = 0; i < 100 && oled_power_state(&pwr) != state; i++) {
+        sleep_ms(100);
+        oled_power_update(&pwr);
+    }
+    CHECK_EQ(oled_power_state(&pwr), state);
+}
+
+static void test_idle_walk_and_wake(void) {
+    setup();
+    CHECK_EQ(panel.contrast, OLED_POWER_DEFAULT_BRIGHT);
+
+    idle_until(OLED_POWER_DIM);
+    CHECK_EQ(panel.contrast, OLED_POWER_DEFAULT_DIM);
+    idle_until(OLED_POWER_OFF);
+    CHECK(!panel.on);
+    CHECK_EQ(panel.contrast, OLED_POWER_DEFAULT_BRIGHT);
+    idle_until(OLED_POWER_CUT);
+    CHECK(!rail.power_enabled);
+    CHECK(!oled_power_is_powered(&pwr));
+
+    CHECK(oled_power_activity(&pwr));
+    CHECK_EQ(oled_power_state(&pwr), OLED_POWER_ACTIVE);
+    CHECK(oled_power_is_powered(&pwr));
+    CHECK(!oled_power_wake_pending(&pwr));
+    CHECK(rail.power_enabled);
+    CHECK_EQ(panel.inits, 1);
+    CHECK(oled_is_dirty(&gfx));     // Panel RAM is gone; repaint
+}
+
+static void test_dead_panel_stays_cut(void) {
+    setup();
+    idle_until(OLED_POWER_CUT);
+
+    panel.answers = false;
+    CHECK(!oled_power_activity(&pwr));
+
+    // Nothing may flush to it, and the rail is not left on for nothing
+    CHECK_EQ(oled_power_state(&pwr), OLED_POWER_CUT);
+    CHECK(!oled_power_is_powered(&pwr));
+    CHECK(oled_power_wake_pending(&pwr));
+    CHECK(!rail.power_enabled);
+    CHECK_EQ(panel.inits, 1);
+
+    // Each update retries while it stays dead
+    oled_power_update(&pwr);
+    oled_power_update(&pwr);
+    CHECK_EQ(panel.inits, 3);
+    CHECK_EQ(oled_power_state(&pwr), OLED_POWER_CUT);
+}
+
+static void test_retry_wakes_when_panel_answers(void) {
+    setup();
+    idle_until(OLED_POWER_CUT);
+    panel.answers = false;
+    CHECK(!oled_power_activity(&pwr));
+
+    sleep_ms(5000);
+    panel.answers = true;
+    oled_power_update(&pwr);
+
+    CHECK_EQ(oled_power_state(&pwr), OLED_POWER_ACTIVE);
+    CHECK(oled_power_is_powered(&pwr));
+    CHECK(!oled_power_wake_pending(&pwr));
+    CHECK(rail.power_enabled);
+    CHECK_EQ(panel.contrast, OLED_POWER_DEFAULT_BRIGHT);
+
+    // Timers restart from the successful wake, not the original request
+    oled_power_update(&pwr);
+    CHECK_EQ(oled_power_state(&pwr), OLED_POWER_ACTIVE);
+}
+
+int main(void) {
+    RUN(test_idle_walk_and_wake);
+    RUN(test_dead_panel_stays_cut);
+    RUN(test_retry_wakes_when_panel_answers);
+    return host_test_result();
+}
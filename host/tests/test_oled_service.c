@@ -0,0 +1,301 @@
+/**
+ * @file test_oled_service.c
+ * @brief oled_service swap and buffer ownership with core1 on a thread
+ *
+ * The panel is a backend that keeps panel RAM and can be held mid-flush
+ * with a gate, so a test can look at the service while core1 still owns
+ * the front buffer.
+ */
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include "host_sdk.h"
+#include "host_test.h"
+#include "oled_service.h"
+
+// ============================================================================
+// GATED PANEL
+// ============================================================================
+
+static struct {
+    pthread_mutex_t lock;
+    pthread_cond_t  changed;
+    bool            gate_closed;
+    bool            waiting;        // core1 is held at the gate
+
+    uint8_t         ram[OLED_NUM_PAGES][OLED_WIDTH];
+    uint8_t         page, col;
+    int             windows;
+    uint8_t         last_page, last_start, last_end;
+    int             flushes_off_core1;
+} panel = {
+    .lock    = PTHREAD_MUTEX_INITIALIZER,
+    .changed = PTHREAD_COND_INITIALIZER,
+};
+
+static void gate_close(void) {
+    pthread_mutex_lock(&panel.lock);
+    panel.gate_closed = true;
+    pthread_mutex_unlock(&panel.lock);
+}
+
+static void gate_open(void) {
+    pthread_mutex_lock(&panel.lock);
+    panel.gate_closed = false;
+    pthread_cond_broadcast(&panel.changed);
+    pthread_mutex_unlock(&panel.lock);
+}
+
+// Until core1 is parked inside a flush
+static void gate_wait_for_core1(void) {
+    pthread_mutex_lock(&panel.lock);
+    while (!panel.waiting) pthread_cond_wait(&panel.changed, &panel.lock);
+    pthread_mutex_unlock(&panel.lock);
+}
+
+static void panel_set_window(void *ctx, uint8_t page, uint8_t start_col, uint8_t end_col) {
+    (void)ctx;
+    if (!host_multicore_on_core1()) panel.flushes_off_core1++;
+
+    pthread_mutex_lock(&panel.lock);
+    panel.waiting = true;
+    pthread_cond_broadcast(&panel.changed);
+    while (panel.gate_closed) pthread_cond_wait(&panel.changed, &panel.lock);
+    panel.waiting = false;
+    pthread_mutex_unlock(&panel.lock);
+
+    panel.page       = page;
+    panel.col        = start_col;
+    panel.windows++;
+    panel.last_page  = page;
+    panel.last_start = start_col;
+    panel.last_end   = end_col;
+}
+
+static void panel_send_data(void *ctx, uint8_t *data, int len) {
+    (void)ctx;
+    for (int i = 0; i < len && panel.col < OLED_WIDTH; i++) {
+        panel.ram[panel.page][panel.col++] = data[i];
+    }
+}
+
+static const oled_backend_t panel_backend = {
+    .set_window = panel_set_window,
+    .send_data  = panel_send_data,
+};
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static oled_t         gfx;
+static oled_service_t svc;
+
+static void setup(void) {
+    host_sdk_reset();
+    pthread_mutex_lock(&panel.lock);
+    memset(panel.ram, 0xAA, sizeof(panel.ram));     // Power-up garbage
+    panel.gate_closed       = false;
+    panel.waiting           = false;
+    panel.windows           = 0;
+    panel.flushes_off_core1 = 0;
+    pthread_mutex_unlock(&panel.lock);
+
+    oled_bind(&gfx, &panel_backend, NULL);
+    oled_service_start(&svc, &gfx);
+}
+
+static bool panel_shows(const uint8_t *buf) {
+    return memcmp(panel.ram, buf, OLED_BUF_LEN) == 0;
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+static void test_first_swap_sends_whole_screen(void) {
+    setup();
+    CHECK(svc.running);
+    CHECK(oled_is_dirty(&svc.canvas));
+
+    oled_service_swap(&svc);
+    oled_service_wait(&svc);
+
+    CHECK_EQ(panel.windows, OLED_NUM_PAGES);
+    CHECK(panel_shows(oled_service_buffer(&svc)));
+    CHECK_EQ(panel.flushes_off_core1, 0);
+    CHECK(!oled_is_dirty(&gfx));
+    oled_service_stop(&svc);
+}
+
+static void test_try_swap_refused_while_in_flight(void) {
+    setup();
+    oled_service_swap(&svc);
+    oled_service_wait(&svc);
+
+    gate_close();
+    oled_set_pixel(&svc.canvas, oled_service_buffer(&svc), 1, 1, true);
+    CHECK(oled_service_try_swap(&svc));
+    gate_wait_for_core1();
+
+    // core1 owns the other buffer: no second frame until it is done
+    oled_set_pixel(&svc.canvas, oled_service_buffer(&svc), 2, 2, true);
+    CHECK(oled_service_poll(&svc));
+    CHECK(!oled_service_try_swap(&svc));
+    CHECK(!oled_service_try_swap(&svc));
+    CHECK(oled_is_dirty(&svc.canvas));
+
+    gate_open();
+    oled_service_wait(&svc);
+    CHECK(!oled_service_poll(&svc));
+
+    // The refused changes went nowhere and go out with the next swap
+    CHECK(oled_service_try_swap(&svc));
+    oled_service_wait(&svc);
+    CHECK(panel_shows(oled_service_buffer(&svc)));
+    CHECK_EQ(panel.ram[0][1], 0x02);
+    CHECK_EQ(panel.ram[0][2], 0x04);
+    oled_service_stop(&svc);
+}
+
+static void test_swap_hands_over_the_back_buffer(void) {
+    setup();
+    oled_service_swap(&svc);
+    oled_service_wait(&svc);
+
+    uint8_t *before = oled_service_buffer(&svc);
+    oled_fill_rect(&svc.canvas, before, 10, 10, 20, 20, true);
+
+    gate_close();
+    CHECK(oled_service_try_swap(&svc));
+    gate_wait_for_core1();
+
+    // Drawing continues in the other buffer, starting from the same frame
+    uint8_t *after = oled_service_buffer(&svc);
+    CHECK(after != before);
+    CHECK(memcmp(after, before, OLED_BUF_LEN) == 0);
+    CHECK(svc.in_flight);
+
+    gate_open();
+    oled_service_wait(&svc);
+    oled_service_stop(&svc);
+}
+
+static void test_frame_in_flight_does_not_tear(void) {
+    setup();
+    oled_service_swap(&svc);
+    oled_service_wait(&svc);
+
+    static uint8_t sent[OLED_BUF_LEN];
+    oled_draw_text(&svc.canvas, oled_service_buffer(&svc), 0, 0, &oled_font_8x8, "frame one");
+    memcpy(sent, oled_service_buffer(&svc), OLED_BUF_LEN);
+
+    gate_close();
+    CHECK(oled_service_try_swap(&svc));
+    gate_wait_for_core1();
+
+    // Scribble over the back buffer while core1 is mid-flush
+    OLED_FILL_BUFFER(oled_service_buffer(&svc));
+    oled_mark_all_dirty(&svc.canvas);
+
+    gate_open();
+    oled_service_wait(&svc);
+    CHECK(panel_shows(sent));
+
+    oled_service_swap(&svc);
+    oled_service_wait(&svc);
+    CHECK(panel_shows(oled_service_buffer(&svc)));
+    oled_service_stop(&svc);
+}
+
+static void test_dirty_spans_handed_to_panel(void) {
+    setup();
+    oled_service_swap(&svc);
+    oled_service_wait(&svc);
+    panel.windows = 0;
+
+    oled_set_pixel(&svc.canvas, oled_service_buffer(&svc), 100, 40, true);
+    oled_service_swap(&svc);
+    oled_service_wait(&svc);
+
+    CHECK_EQ(panel.windows, 1);
+    CHECK_EQ(panel.last_page, 40 / OLED_PAGE_HEIGHT);
+    CHECK_EQ(panel.last_start, 100);
+    CHECK_EQ(panel.last_end, 100);
+    CHECK(!oled_is_dirty(&svc.canvas));
+
+    // Nothing dirty: the swap succeeds and sends nothing
+    CHECK(oled_service_try_swap(&svc));
+    CHECK(!svc.in_flight);
+    CHECK_EQ(panel.windows, 1);
+    oled_service_stop(&svc);
+}
+
+static void test_stop_keeps_unsent_changes(void) {
+    setup();
+    oled_service_swap(&svc);
+    oled_service_wait(&svc);
+
+    oled_set_pixel(&svc.canvas, oled_service_buffer(&svc), 64, 20, true);
+    oled_service_stop(&svc);
+
+    CHECK(!svc.running);
+    CHECK(oled_is_dirty(&gfx));
+    CHECK_EQ(gfx.dirty_start[20 / OLED_PAGE_HEIGHT], 64);
+    CHECK_EQ(gfx.dirty_end[20 / OLED_PAGE_HEIGHT], 64);
+
+    // Stopping twice is harmless
+    oled_service_stop(&svc);
+}
+
+static void test_restart(void) {
+    setup();
+    oled_service_swap(&svc);
+    oled_service_wait(&svc);
+    oled_service_stop(&svc);
+
+    oled_service_start(&svc, &gfx);
+    panel.windows = 0;
+    oled_draw_text(&svc.canvas, oled_service_buffer(&svc), 8, 8, &oled_font_5x7, "again");
+    oled_service_swap(&svc);
+    oled_service_wait(&svc);
+
+    // A restart starts blank and sends the whole screen again
+    CHECK_EQ(panel.windows, OLED_NUM_PAGES);
+    CHECK(panel_shows(oled_service_buffer(&svc)));
+    CHECK_EQ(panel.flushes_off_core1, 0);
+    oled_service_stop(&svc);
+}
+
+static void test_random_drawing(void) {
+    setup();
+    srand(1);
+
+    int swaps = 0;
+    for (int i = 0; i < 2000; i++) {
+        int x = rand() % OLED_WIDTH, y = rand() % OLED_HEIGHT;
+        int w = 1 + rand() % 24,     h = 1 + rand() % 16;
+        oled_fill_rect(&svc.canvas, oled_service_buffer(&svc), x, y, w, h, rand() & 1);
+        if (oled_service_try_swap(&svc)) swaps++;
+    }
+    oled_service_swap(&svc);
+    oled_service_wait(&svc);
+
+    CHECK(swaps > 0);
+    CHECK(panel_shows(oled_service_buffer(&svc)));
+    CHECK_EQ(panel.flushes_off_core1, 0);
+    oled_service_stop(&svc);
+}
+
+int main(void) {
+    RUN(test_first_swap_sends_whole_screen);
+    RUN(test_try_swap_refused_while_in_flight);
+    RUN(test_swap_hands_over_the_back_buffer);
+    RUN(test_frame_in_flight_does_not_tear);
+    RUN(test_dirty_spans_handed_to_panel);
+    RUN(test_stop_keeps_unsent_changes);
+    RUN(test_restart);
+    RUN(test_random_drawing);
+    return host_test_result();
+}
@@ -0,0 +1,368 @@
+/**
+ * @file test_ssd1306_async.c
+ * @brief ssd1306_render_async() state machine against simulated DMA and I2C
+ *
+ * One transaction per render: the window write, then DMA staged a page at a
+ * time from ssd1306_render_async_poll(), with the control byte in front of
+ * the first page and STOP on the last word of the last page.
+ */
+
+#include <string.h>
+#include "host_sdk.h"
+#include "host_test.h"
+#include "ssd1306.h"
+
+static ssd1306_t             dev;
+static ssd1306_framebuffer_t fb;
+static oled_shadow_t         shadow;
+
+// Last data transaction in full, as the panel received it
+static struct {
+    uint8_t data[HOST_I2C_TXN_MAX];
+    size_t  len;
+    bool    nak;        // NAK the next data transaction at STOP
+} panel;
+
+static struct {
+    int  calls;
+    bool ok;
+} done;
+
+static int panel_receive(void *ctx, i2c_inst_t *i2c, uint8_t addr, const uint8_t *data, size_t len) {
+    (void)ctx; (void)i2c; (void)addr;
+    if (len == 0 || data[0] != 0x40) return (int)len;
+
+    if (panel.nak) {
+        panel.nak = false;
+        return -1;
+    }
+    memcpy(panel.data, data, len);
+    panel.len = len;
+    return (int)len;
+}
+
+static void on_done(void *user_data, bool ok) {
+    (void)user_data;
+    done.calls++;
+    done.ok = ok;
+}
+
+static void setup(void) {
+    host_sdk_reset();
+    memset(&dev, 0, sizeof(dev));
+    memset(&fb, 0, sizeof(fb));
+    memset(&panel, 0, sizeof(panel));
+    memset(&done, 0, sizeof(done));
+
+    ssd1306_config_t config = ssd1306_create_config(i2c0, 4, 5);
+    CHECK(ssd1306_init(&dev, &config));
+    ssd1306_flush(&dev, &fb);
+
+    host_i2c_set_handler(panel_receive, NULL);
+    host_i2c_clear_log();
+}
+
+static int poll_to_end(void) {
+    int polls = 0;
+    while (ssd1306_render_async_poll(&dev)) polls++;
+    return polls;
+}
+
+static void clear_abort(void) {
+    i2c0->hw->raw_intr_stat &= ~I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS;
+}
+
+// Panel pages p0..p1 dirty across the full width, every other page clean
+static void check_dirty_pages(int p0, int p1) {
+    uint8_t start[OLED_NUM_PAGES], end[OLED_NUM_PAGES];
+    oled_panel_dirty(&dev.gfx, start, end);
+
+    for (int page = 0; page < SSD1306_NUM_PAGES; page++) {
+        if (page >= p0 && page <= p1) {
+            CHECK_EQ(start[page], 0);
+            CHECK_EQ(end[page], SSD1306_WIDTH - 1);
+        } else {
+            CHECK(start[page] > end[page]);
+        }
+    }
+}
+
+// ============================================================================
+// STAGING
+// ============================================================================
+
+static void test_pages_staged_one_dma_each(void) {
+    setup();
+    ssd1306_set_pixel(&dev, fb.data, 3, 2 * 8, true);      // Page 2
+    ssd1306_set_pixel(&dev, fb.data, 90, 4 * 8 + 7, true); // Page 4
+
+    CHECK(ssd1306_render_async(&dev, &fb, on_done, NULL));
+    CHECK(ssd1306_is_busy(&dev));
+    poll_to_end();
+    CHECK(!ssd1306_is_busy(&dev));
+
+    // Dirty pages widen to one full-width window
+    const host_i2c_log_t *log = host_i2c_log();
+    const uint8_t window[] = { 0x00, SSD1306_SET_COL_ADDR, 0, SSD1306_WIDTH - 1,
+                               SSD1306_SET_PAGE_ADDR, 2, 4 };
+    CHECK_EQ(log->transactions, 2);
+    CHECK_EQ(log->txn[0].len, sizeof(window));
+    CHECK(memcmp(log->txn[0].head, window, sizeof(window)) == 0);
+
+    // One DMA per page: control byte in front of the first, STOP on the
+    // last word of the last and nowhere else
+    const host_dma_log_t *dma = host_dma_log();
+    CHECK_EQ(dma->count, 3);
+    CHECK_EQ(dma->transfer[0].count, 1 + SSD1306_WIDTH);
+    CHECK_EQ(dma->transfer[0].first, 0x40);
+    CHECK_EQ(dma->transfer[1].count, SSD1306_WIDTH);
+    CHECK_EQ(dma->transfer[2].count, SSD1306_WIDTH);
+    CHECK_EQ(dma->transfer[0].stops, 0);
+    CHECK_EQ(dma->transfer[1].stops, 0);
+    CHECK_EQ(dma->transfer[2].stops, 1);
+    CHECK_EQ(dma->transfer[2].stop_at, SSD1306_WIDTH - 1);
+
+    // ...so the three pages arrive as a single transaction
+    CHECK_EQ(log->txn[1].len, 1 + 3 * SSD1306_WIDTH);
+    CHECK_EQ(panel.len, 1 + 3 * SSD1306_WIDTH);
+    CHECK_EQ(panel.data[1 + 3], 0x01);
+    CHECK_EQ(panel.data[1 + 2 * SSD1306_WIDTH + 90], 0x80);
+
+    CHECK_EQ(done.calls, 1);
+    CHECK(done.ok);
+    CHECK(!ssd1306_is_dirty(&dev));
+}
+
+static void test_single_page_carries_control_and_stop(void) {
+    setup();
+    ssd1306_set_pixel(&dev, fb.data, 0, 63, true);
+
+    CHECK(ssd1306_render_async(&dev, &fb, on_done, NULL));
+    poll_to_end();
+
+    const host_dma_log_t *dma = host_dma_log();
+    CHECK_EQ(dma->count, 1);
+    CHECK_EQ(dma->transfer[0].count, 1 + SSD1306_WIDTH);
+    CHECK_EQ(dma->transfer[0].first, 0x40);
+    CHECK_EQ(dma->transfer[0].stops, 1);
+    CHECK_EQ(dma->transfer[0].stop_at, SSD1306_WIDTH);
+    CHECK_EQ(panel.len, 1 + SSD1306_WIDTH);
+    CHECK(done.ok);
+}
+
+static void test_nothing_dirty_starts_nothing(void) {
+    setup();
+
+    CHECK(!ssd1306_render_async(&dev, &fb, on_done, NULL));
+    CHECK(!ssd1306_is_busy(&dev));
+    CHECK_EQ(host_i2c_log()->transactions, 0);
+    CHECK_EQ(done.calls, 0);
+}
+
+// ============================================================================
+// POLLING
+// ============================================================================
+
+static void test_transfer_advances_only_when_polled(void) {
+    setup();
+    host_dma_set_latency(3);
+    ssd1306_mark_all_dirty(&dev);
+
+    CHECK(ssd1306_render_async(&dev, &fb, on_done, NULL));
+
+    // Without polls the first page never finishes and nothing else is staged
+    for (int i = 0; i < 3; i++) CHECK(ssd1306_render_async_poll(&dev));
+    CHECK_EQ(host_dma_log()->count, 0);
+    CHECK_EQ(host_i2c_log()->transactions, 1);     // Window only
+
+    int polls = 3 + poll_to_end();
+    CHECK_EQ(host_dma_log()->count, SSD1306_NUM_PAGES);
+    CHECK(polls >= 3 * SSD1306_NUM_PAGES);
+    CHECK_EQ(panel.len, 1 + SSD1306_BUF_LEN);
+    CHECK_EQ(done.calls, 1);
+}
+
+static void test_busy_until_fifo_drains(void) {
+    setup();
+    ssd1306_set_pixel(&dev, fb.data, 1, 1, true);
+    CHECK(ssd1306_render_async(&dev, &fb, on_done, NULL));
+
+    // Last DMA done, but the controller is still shifting bytes out
+    i2c0->hw->status = I2C_IC_STATUS_MST_ACTIVITY_BITS;
+    CHECK(ssd1306_render_async_poll(&dev));
+    CHECK(ssd1306_render_async_poll(&dev));
+    CHECK_EQ(done.calls, 0);
+
+    i2c0->hw->status = I2C_IC_STATUS_TFE_BITS;
+    CHECK(!ssd1306_render_async_poll(&dev));
+    CHECK_EQ(done.calls, 1);
+}
+
+static void test_second_render_refused_while_busy(void) {
+    setup();
+    host_dma_set_latency(2);
+    ssd1306_set_pixel(&dev, fb.data, 1, 1, true);
+    CHECK(ssd1306_render_async(&dev, &fb, on_done, NULL));
+
+    ssd1306_set_pixel(&dev, fb.data, 2, 2, true);   // Waits for the render
+    CHECK(!ssd1306_is_busy(&dev));
+    CHECK_EQ(done.calls, 1);
+    CHECK(ssd1306_render_async(&dev, &fb, on_done, NULL));
+    CHECK(!ssd1306_render_async(&dev, &fb, on_done, NULL));
+    poll_to_end();
+    CHECK_EQ(done.calls, 2);
+}
+
+static void test_drawing_waits_for_transfer(void) {
+    setup();
+    host_dma_set_latency(2);
+    ssd1306_mark_all_dirty(&dev);
+    CHECK(ssd1306_render_async(&dev, &fb, on_done, NULL));
+
+    // Blocks until the render is done, so the panel gets the old pixel
+    ssd1306_set_pixel(&dev, fb.data, 0, 0, true);
+
+    CHECK(!ssd1306_is_busy(&dev));
+    CHECK_EQ(done.calls, 1);
+    CHECK_EQ(panel.len, 1 + SSD1306_BUF_LEN);
+    CHECK_EQ(panel.data[1], 0x00);
+    CHECK_EQ(fb.data[0], 0x01);
+
+    uint8_t start[OLED_NUM_PAGES], end[OLED_NUM_PAGES];
+    oled_panel_dirty(&dev.gfx, start, end);
+    CHECK_EQ(start[0], 0);
+    CHECK_EQ(end[0], 0);
+}
+
+// ============================================================================
+// ABORT RECOVERY
+// ============================================================================
+
+static void test_abort_without_shadow_remarks_pages(void) {
+    setup();
+    host_dma_set_latency(1);
+    ssd1306_set_pixel(&dev, fb.data, 40, 1 * 8, true);     // Page 1
+    ssd1306_set_pixel(&dev, fb.data, 41, 3 * 8, true);     // Page 3
+
+    CHECK(ssd1306_render_async(&dev, &fb, on_done, NULL));
+    CHECK(ssd1306_render_async_poll(&dev));     // Page 1 in flight
+    host_i2c_abort(i2c0);
+    poll_to_end();
+
+    CHECK_EQ(done.calls, 1);
+    CHECK(!done.ok);
+    CHECK(!ssd1306_is_busy(&dev));
+    CHECK_EQ(panel.len, 0);
+    check_dirty_pages(1, 3);
+
+    // Retry sends the same pages
+    clear_abort();
+    host_dma_set_latency(0);
+    CHECK(ssd1306_render_async(&dev, &fb, on_done, NULL));
+    poll_to_end();
+    CHECK(done.ok);
+    CHECK_EQ(panel.len, 1 + 3 * SSD1306_WIDTH);
+}
+
+static void test_abort_with_shadow_invalidates_it(void) {
+    setup();
+    ssd1306_set_shadow(&dev, &shadow);
+    ssd1306_flush(&dev, &fb);
+    CHECK(dev.gfx.shadow_valid);
+
+    host_dma_set_latency(1);
+    ssd1306_set_pixel(&dev, fb.data, 5, 5 * 8, true);      // Page 5
+    CHECK(ssd1306_render_async(&dev, &fb, on_done, NULL));
+    host_i2c_abort(i2c0);
+    poll_to_end();
+
+    // The shadow took page 5 before it was sent; it can no longer be trusted
+    CHECK(!done.ok);
+    CHECK(!dev.gfx.shadow_valid);
+    check_dirty_pages(0, SSD1306_NUM_PAGES - 1);
+    clear_abort();
+}
+
+static void test_nak_at_stop_reports_failure(void) {
+    setup();
+    ssd1306_set_pixel(&dev, fb.data, 7, 7, true);
+    panel.nak = true;
+
+    CHECK(ssd1306_render_async(&dev, &fb, on_done, NULL));
+    poll_to_end();
+
+    CHECK_EQ(done.calls, 1);
+    CHECK(!done.ok);
+    check_dirty_pages(0, 0);
+    clear_abort();
+}
+
+// ============================================================================
+// ROTATION
+// ============================================================================
+
+static bool canvas_pixel(int x, int y) {
+    return (fb.data[(y / 8) * dev.gfx.width + x] >> (y % 8)) & 1;
+}
+
+static void test_transposed_pages(void) {
+    setup();
+    CHECK(ssd1306_set_rotation(&dev, OLED_ROTATE_90));
+    CHECK_EQ(dev.gfx.width, SSD1306_HEIGHT);
+    CHECK_EQ(dev.gfx.height, SSD1306_WIDTH);
+
+    ssd1306_draw_line(&dev, fb.data, 0, 0, 63, 127, true);
+    ssd1306_draw_rect(&dev, fb.data, 10, 20, 30, 40, true);
+    ssd1306_write_string(&dev, fb.data, 2, 100, "Hi");
+
+    CHECK(ssd1306_render_async(&dev, &fb, on_done, NULL));
+    poll_to_end();
+    CHECK(done.ok);
+    CHECK_EQ(panel.len, 1 + SSD1306_BUF_LEN);
+
+    // Panel pixel (X, Y) is canvas pixel (Y, X); the flip bits do the rest
+    int mismatches = 0;
+    for (int page = 0; page < SSD1306_NUM_PAGES; page++) {
+        for (int col = 0; col < SSD1306_WIDTH; col++) {
+            uint8_t byte = panel.data[1 + page * SSD1306_WIDTH + col];
+            for (int bit = 0; bit < 8; bit++) {
+                if (((byte >> bit) & 1) != canvas_pixel(page * 8 + bit, col)) mismatches++;
+            }
+        }
+    }
+    CHECK_EQ(mismatches, 0);
+}
+
+static void test_transposed_abort_marks_all_dirty(void) {
+    setup();
+    CHECK(ssd1306_set_rotation(&dev, OLED_ROTATE_90));
+    ssd1306_flush(&dev, &fb);
+
+    host_dma_set_latency(1);
+    ssd1306_set_pixel(&dev, fb.data, 20, 3, true);
+    CHECK(ssd1306_render_async(&dev, &fb, on_done, NULL));
+    host_i2c_abort(i2c0);
+    poll_to_end();
+
+    CHECK(!done.ok);
+    CHECK_EQ(dev.gfx.dirty_start[0], 0);
+    CHECK_EQ(dev.gfx.dirty_end[0], dev.gfx.width - 1);
+    CHECK_EQ(dev.gfx.dirty_start[dev.gfx.height / 8 - 1], 0);
+    clear_abort();
+}
+
+int main(void) {
+    RUN(test_pages_staged_one_dma_each);
+    RUN(test_single_page_carries_control_and_stop);
+    RUN(test_nothing_dirty_starts_nothing);
+    RUN(test_transfer_advances_only_when_polled);
+    RUN(test_busy_until_fifo_drains);
+    RUN(test_second_render_refused_while_busy);
+    RUN(test_drawing_waits_for_transfer);
+    RUN(test_abort_without_shadow_remarks_pages);
+    RUN(test_abort_with_shadow_invalidates_it);
+    RUN(test_nak_at_stop_reports_failure);
+    RUN(test_transposed_pages);
+    RUN(test_transposed_abort_marks_all_dirty);
+    return host_test_result();
+}
@@ -0,0 +1,127 @@
+/**
+ * @file test_ssd1306_console.c
+ * @brief Log console scrolling, checked on the decoded panel
+ *
+ * The panel model (oled_core/bench/sim_i2c) decodes the driver's writes
+ * into GDDRAM and tracks the display start line, so the test sees the
+ * screen the way the controller shows it.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "host_test.h"
+#include "sim_i2c.h"
+#include "ssd1306.h"
+
+static sim_i2c_t             bus;
+static sim_panel_t           panel;
+static ssd1306_t             dev;
+static ssd1306_framebuffer_t fb;
+
+static void setup(uint8_t width, uint8_t height) {
+    memset(&dev, 0, sizeof(dev));
+    memset(&fb, 0, sizeof(fb));
+    sim_panel_init(&panel, SIM_SSD1306);
+    sim_i2c_init(&bus, SIM_I2C_TIMING_400K, &panel);
+
+    ssd1306_config_t config = ssd1306_create_config(i2c0, 4, 5);
+    config.width  = width;
+    config.height = height;
+    CHECK(ssd1306_init(&dev, &config));
+}
+
+// Reference screen: what a freshly drawn buffer with these lines looks like
+static void draw_reference(uint8_t *buf, const char lines[][16], int count) {
+    static oled_t ref;
+    static const oled_backend_t no_panel = { 0 };
+
+    oled_bind(&ref, &no_panel, NULL);
+    memset(buf, 0, OLED_BUF_LEN);
+    for (int i = 0; i < count; i++) {
+        oled_draw_text(&ref, buf, 0, i * OLED_PAGE_HEIGHT, &oled_font_8x8, lines[i]);
+    }
+}
+
+static int screen_mismatches(const uint8_t *expected, int width, int height) {
+    int mismatches = 0;
+    for (int page = 0; page < height / OLED_PAGE_HEIGHT; page++) {
+        for (int col = 0; col < width; col++) {
+            if (sim_panel_shown(&panel, height, page, col) != expected[page * width + col]) {
+                mismatches++;
+            }
+        }
+    }
+    return mismatches;
+}
+
+static void test_console_wraps_on_64_rows(void) {
+    setup(128, 64);
+    CHECK(ssd1306_console_begin(&dev, &fb, NULL));
+
+    char lines[11][16];
+    for (int i = 0; i < 11; i++) {
+        snprintf(lines[i], sizeof(lines[i]), "line %d", i);
+        ssd1306_console_print(&dev, &fb, lines[i]);
+    }
+
+    // Eleven lines on eight rows: the screen shows lines 3..10, oldest on top
+    static uint8_t expected[OLED_BUF_LEN];
+    draw_reference(expected, &lines[3], 8);
+    CHECK_EQ(panel.start_line, 3 * OLED_PAGE_HEIGHT);
+    CHECK_EQ(screen_mismatches(expected, 128, 64), 0);
+
+    // One page write per line once the screen is full
+    sim_i2c_reset_counters(&bus);
+    ssd1306_console_print(&dev, &fb, "line 11");
+    CHECK_EQ(bus.transactions, 1 + 2);      // Start line, window, data
+
+    ssd1306_console_end(&dev);
+    CHECK_EQ(panel.start_line, 0);
+}
+
+static void test_start_line_indexes_all_ram_rows(void) {
+    setup(128, 32);
+
+    // Rows 40..71 of a 64-row RAM, wrapping: not folded onto the 32 rows
+    ssd1306_set_start_line(&dev, 40);
+    CHECK_EQ(dev.start_line, 40);
+    CHECK_EQ(panel.start_line, 40);
+    ssd1306_set_start_line(&dev, 70);
+    CHECK_EQ(panel.start_line, 6);
+}
+
+static void test_console_refused_on_32_rows(void) {
+    setup(128, 32);
+
+    ssd1306_write_string(&dev, fb.data, 0, 0, "before");
+    ssd1306_flush(&dev, &fb);
+
+    static uint8_t expected[128 * 4];
+    memcpy(expected, fb.data, sizeof(expected));
+
+    CHECK(!ssd1306_console_begin(&dev, &fb, NULL));
+    sim_i2c_reset_counters(&bus);
+
+    // Enough lines to have wrapped twice: nothing reaches the panel
+    for (int i = 0; i < 10; i++) ssd1306_console_print(&dev, &fb, "ignored");
+    ssd1306_console_end(&dev);
+
+    CHECK_EQ(bus.transactions, 0);
+    CHECK_EQ(panel.start_line, 0);
+    CHECK_EQ(screen_mismatches(expected, 128, 32), 0);
+    CHECK(memcmp(fb.data, expected, sizeof(expected)) == 0);
+}
+
+static void test_console_refused_when_rotated(void) {
+    setup(128, 64);
+    CHECK(ssd1306_set_rotation(&dev, OLED_ROTATE_90));
+    CHECK(!ssd1306_console_begin(&dev, &fb, NULL));
+}
+
+int main(void) {
+    RUN(test_console_wraps_on_64_rows);
+    RUN(test_start_line_indexes_all_ram_rows);
+    RUN(test_console_refused_on_32_rows);
+    RUN(test_console_refused_when_rotated);
+    return host_test_result();
+}
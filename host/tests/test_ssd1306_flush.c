@@ -0,0 +1,141 @@
+/**
+ * @file test_ssd1306_flush.c
+ * @brief Bytes and address windows ssd1306_flush() puts on the bus
+ *
+ * Each dirty page costs one window command (COL_ADDR + PAGE_ADDR, 7 bytes)
+ * and one data write (control byte + the dirty span).
+ */
+
+#include <string.h>
+#include "host_sdk.h"
+#include "host_test.h"
+#include "ssd1306.h"
+
+#define WINDOW_LEN  7
+
+static ssd1306_t             dev;
+static ssd1306_framebuffer_t fb;
+
+static void setup(void) {
+    host_sdk_reset();
+    memset(&dev, 0, sizeof(dev));
+    memset(&fb, 0, sizeof(fb));
+
+    ssd1306_config_t config = ssd1306_create_config(i2c0, 4, 5);
+    CHECK(ssd1306_init(&dev, &config));
+    host_i2c_clear_log();
+}
+
+// Transaction i is the window for columns c0..c1 of page p, and i + 1
+// the data for it
+static void check_page_write(int i, uint8_t c0, uint8_t c1, uint8_t p) {
+    const host_i2c_log_t *log = host_i2c_log();
+    const uint8_t window[WINDOW_LEN] = { 0x00, SSD1306_SET_COL_ADDR, c0, c1, SSD1306_SET_PAGE_ADDR, p, p };
+
+    CHECK(i + 1 < log->count);
+    if (i + 1 >= log->count) return;
+
+    CHECK_EQ(log->txn[i].addr, SSD1306_DEFAULT_ADDRESS);
+    CHECK_EQ(log->txn[i].len, WINDOW_LEN);
+    CHECK(memcmp(log->txn[i].head, window, WINDOW_LEN) == 0);
+
+    CHECK_EQ(log->txn[i + 1].addr, SSD1306_DEFAULT_ADDRESS);
+    CHECK_EQ(log->txn[i + 1].len, 1 + (c1 - c0 + 1));
+    CHECK_EQ(log->txn[i + 1].head[0], 0x40);
+}
+
+static void test_init_is_one_command_stream(void) {
+    host_sdk_reset();
+    memset(&dev, 0, sizeof(dev));
+
+    ssd1306_config_t config = ssd1306_create_config(i2c0, 4, 5);
+    CHECK(ssd1306_init(&dev, &config));
+
+    // Presence probe, then the whole init sequence behind one control byte
+    const host_i2c_log_t *log = host_i2c_log();
+    CHECK_EQ(log->transactions, 2);
+    CHECK_EQ(log->txn[0].len, 0);
+    CHECK_EQ(log->txn[1].head[0], 0x00);
+    CHECK(log->txn[1].len > 1);
+}
+
+static void test_first_flush_sends_every_page(void) {
+    setup();
+
+    ssd1306_flush(&dev, &fb);
+
+    const host_i2c_log_t *log = host_i2c_log();
+    CHECK_EQ(log->bytes, SSD1306_NUM_PAGES * (WINDOW_LEN + 1 + SSD1306_WIDTH));    // 1088
+    CHECK_EQ(log->transactions, 2 * SSD1306_NUM_PAGES);                            // 16
+    for (int page = 0; page < SSD1306_NUM_PAGES; page++) {
+        check_page_write(2 * page, 0, SSD1306_WIDTH - 1, (uint8_t)page);
+    }
+}
+
+static void test_clean_flush_sends_nothing(void) {
+    setup();
+    ssd1306_flush(&dev, &fb);
+    host_i2c_clear_log();
+
+    ssd1306_flush(&dev, &fb);
+
+    CHECK_EQ(host_i2c_log()->bytes, 0);
+    CHECK_EQ(host_i2c_log()->transactions, 0);
+}
+
+static void test_two_chars_send_their_columns(void) {
+    setup();
+    ssd1306_flush(&dev, &fb);
+    host_i2c_clear_log();
+
+    ssd1306_write_char(&dev, fb.data, 0, 0, 'A');
+    ssd1306_write_char(&dev, fb.data, 8, 0, 'B');
+    ssd1306_flush(&dev, &fb);
+
+    const host_i2c_log_t *log = host_i2c_log();
+    CHECK_EQ(log->bytes, WINDOW_LEN + 1 + 16);      // 24
+    CHECK_EQ(log->transactions, 2);
+    check_page_write(0, 0, 15, 0);
+}
+
+static void test_single_pixel_sends_one_column(void) {
+    setup();
+    ssd1306_flush(&dev, &fb);
+    host_i2c_clear_log();
+
+    ssd1306_set_pixel(&dev, fb.data, 100, 40, true);
+    ssd1306_flush(&dev, &fb);
+
+    const host_i2c_log_t *log = host_i2c_log();
+    CHECK_EQ(log->bytes, WINDOW_LEN + 1 + 1);
+    CHECK_EQ(log->transactions, 2);
+    check_page_write(0, 100, 100, 40 / 8);
+    CHECK_EQ(log->txn[1].head[1], 1 << (40 % 8));
+}
+
+static void test_spans_on_several_pages(void) {
+    setup();
+    ssd1306_flush(&dev, &fb);
+    host_i2c_clear_log();
+
+    ssd1306_set_pixel(&dev, fb.data, 10, 3, true);      // Page 0, column 10
+    ssd1306_set_pixel(&dev, fb.data, 20, 3, true);      // Page 0, column 20
+    ssd1306_set_pixel(&dev, fb.data, 127, 63, true);    // Page 7, column 127
+    ssd1306_flush(&dev, &fb);
+
+    const host_i2c_log_t *log = host_i2c_log();
+    CHECK_EQ(log->bytes, (WINDOW_LEN + 1 + 11) + (WINDOW_LEN + 1 + 1));
+    CHECK_EQ(log->transactions, 4);
+    check_page_write(0, 10, 20, 0);
+    check_page_write(2, 127, 127, 7);
+}
+
+int main(void) {
+    RUN(test_init_is_one_command_stream);
+    RUN(test_first_flush_sends_every_page);
+    RUN(test_clean_flush_sends_nothing);
+    RUN(test_two_chars_send_their_columns);
+    RUN(test_single_pixel_sends_one_column);
+    RUN(test_spans_on_several_pages);
+    return host_test_result();
+}
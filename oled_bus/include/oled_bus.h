@@ -0,0 +1,106 @@
+/**
+ * @file oled_bus.h
+ * @brief Several OLED panels on one shared I2C bus
+ * @version 1.0
+ *
+ * Sets the bus up once and shares it between any mix of ssd1306/sh1106
+ * panels. Flushes are scheduled round-robin: each oled_bus_service() call
+ * serves the next panel that has changes and sends at most that panel's
+ * byte budget of pixel data. Whatever does not fit stays dirty for the
+ * panel's next turn, so no panel waits longer than one round of budgets,
+ * however much another one redraws.
+ *
+ * At 400 kHz one pixel byte is about 23 us on the wire, so a budget of
+ * 256 bytes keeps a turn under roughly 6-7 ms including window commands.
+ *
+ * Usage:
+ *   static oled_bus_t bus;
+ *   oled_bus_init(&bus, i2c0, 16, 17, 400000);
+ *
+ *   ssd1306_config_t cfg = ssd1306_create_config(i2c0, 16, 17);
+ *   cfg.shared_bus = true;                   // Leave the bus to oled_bus
+ *   ssd1306_init(&left, &cfg);
+ *   cfg.address = 0x3D;
+ *   ssd1306_init(&right, &cfg);
+ *
+ *   oled_bus_add(&bus, &left.gfx,  &left_fb,  256);
+ *   oled_bus_add(&bus, &right.gfx, &right_fb, 256);
+ *
+ *   for (;;) {
+ *       draw_panels();
+ *       oled_bus_service(&bus);               // One panel, one budget
+ *   }
+ */
+
+#ifndef OLED_BUS_H
+#define OLED_BUS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "hardware/i2c.h"
+#include "oled_core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// BUS PARAMETERS
+// ============================================================================
+
+#ifndef OLED_BUS_MAX_PANELS
+#define OLED_BUS_MAX_PANELS     4
+#endif
+
+// ============================================================================
+// BUS STATE
+// ============================================================================
+
+typedef struct {
+    oled_t             *gfx;        // Panel's core (dev->gfx)
+    oled_framebuffer_t *fb;         // Buffer flushed to it
+    uint16_t            budget;     // Pixel bytes per turn, 0: no limit
+} oled_bus_panel_t;
+
+typedef struct {
+    i2c_inst_t       *i2c;
+    uint8_t           sda_pin;
+    uint8_t           scl_pin;
+    uint32_t          baudrate;
+
+    oled_bus_panel_t  panels[OLED_BUS_MAX_PANELS];
+    uint8_t           count;
+    uint8_t           next;         // Panel whose turn comes first
+} oled_bus_t;
+
+// ============================================================================
+// FUNCTION DECLARATIONS
+// ============================================================================
+
+// Initialize the I2C block and pins once. Panels on this bus must be
+// initialized with shared_bus set in their config.
+void oled_bus_init(oled_bus_t *bus, i2c_inst_t *i2c, uint8_t sda_pin, uint8_t scl_pin,
+                   uint32_t baudrate);
+
+// Release the pins; deinit the panels first
+void oled_bus_deinit(oled_bus_t *bus);
+
+// Register an initialized panel and the framebuffer it shows. Returns false
+// when OLED_BUS_MAX_PANELS are already registered.
+bool oled_bus_add(oled_bus_t *bus, oled_t *gfx, oled_framebuffer_t *fb, uint16_t budget);
+
+// Give the next panel with changes its turn. Returns the pixel bytes sent
+// (0 if no panel had changes, or a shadow showed nothing really differed).
+int  oled_bus_service(oled_bus_t *bus);
+
+// Serve panels until all are up to date
+void oled_bus_flush_all(oled_bus_t *bus);
+
+// True if any panel has changes waiting
+bool oled_bus_is_dirty(const oled_bus_t *bus);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OLED_BUS_H
@@ -0,0 +1,95 @@
+/**
+ * @file oled_bus.c
+ * @brief Shared I2C bus and round-robin flush scheduling for OLED panels
+ * @version 1.0
+ */
+
+#include "oled_bus.h"
+#include "hardware/gpio.h"
+
+// ============================================================================
+// INTERNAL
+// ============================================================================
+
+// A DMA transfer to any panel owns the bus; nothing else may start on it
+static void wait_bus_idle(oled_bus_t *bus) {
+    for (int i = 0; i < bus->count; i++) {
+        oled_wait_idle(bus->panels[i].gfx);
+    }
+}
+
+// ============================================================================
+// BUS SETUP
+// ============================================================================
+
+void oled_bus_init(oled_bus_t *bus, i2c_inst_t *i2c, uint8_t sda_pin, uint8_t scl_pin,
+                   uint32_t baudrate) {
+    bus->i2c      = i2c;
+    bus->sda_pin  = sda_pin;
+    bus->scl_pin  = scl_pin;
+    bus->baudrate = baudrate;
+    bus->count    = 0;
+    bus->next     = 0;
+
+    i2c_init(i2c, baudrate);
+    gpio_set_function(sda_pin, GPIO_FUNC_I2C);
+    gpio_set_function(scl_pin, GPIO_FUNC_I2C);
+    gpio_pull_up(sda_pin);
+    gpio_pull_up(scl_pin);
+}
+
+void oled_bus_deinit(oled_bus_t *bus) {
+    wait_bus_idle(bus);
+    bus->count = 0;
+
+    i2c_deinit(bus->i2c);
+    gpio_set_function(bus->sda_pin, GPIO_FUNC_SIO);
+    gpio_set_function(bus->scl_pin, GPIO_FUNC_SIO);
+    gpio_set_dir(bus->sda_pin, GPIO_OUT);
+    gpio_set_dir(bus->scl_pin, GPIO_OUT);
+    gpio_put(bus->sda_pin, 0);
+    gpio_put(bus->scl_pin, 0);
+}
+
+bool oled_bus_add(oled_bus_t *bus, oled_t *gfx, oled_framebuffer_t *fb, uint16_t budget) {
+    if (bus->count >= OLED_BUS_MAX_PANELS) return false;
+
+    oled_bus_panel_t *p = &bus->panels[bus->count++];
+    p->gfx    = gfx;
+    p->fb     = fb;
+    p->budget = budget;
+    return true;
+}
+
+// ============================================================================
+// SCHEDULING
+// ============================================================================
+
+int oled_bus_service(oled_bus_t *bus) {
+    wait_bus_idle(bus);
+
+    // First panel with changes, starting after the one served last
+    for (int n = 0; n < bus->count; n++) {
+        int i = (bus->next + n) % bus->count;
+        oled_bus_panel_t *p = &bus->panels[i];
+        if (!oled_is_dirty(p->gfx)) continue;
+
+        bus->next = (uint8_t)((i + 1) % bus->count);
+        return oled_flush_budget(p->gfx, p->fb, p->budget);
+    }
+    return 0;
+}
+
+void oled_bus_flush_all(oled_bus_t *bus) {
+    // Every turn clears at least one dirty page, so this terminates
+    while (oled_bus_is_dirty(bus)) {
+        oled_bus_service(bus);
+    }
+}
+
+bool oled_bus_is_dirty(const oled_bus_t *bus) {
+    for (int i = 0; i < bus->count; i++) {
+        if (oled_is_dirty(bus->panels[i].gfx)) return true;
+    }
+    return false;
+}
@@ -0,0 +1,209 @@
+/**
+ * @file oled_bench.c
+ * @brief Panel refresh benchmarks against a simulated I2C bus
+ * @version 1.0
+ *
+ * Runs typical screen updates through the real ssd1306 and sh1106 drivers
+ * and reports what each frame puts on the bus: bytes, transactions and the
+ * estimated bus time. Every scenario first brings the panel in sync with
+ * the framebuffer and then counts only its own frames, so the numbers are
+ * the steady-state cost of one update.
+ *
+ * Usage: oled_bench [scl_hz]     (default 400000; 100000 uses standard mode)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "oled_core.h"
+#include "oled_chart.h"
+#include "oled_font.h"
+#include "sh1106_i2c.h"
+#include "ssd1306.h"
+#include "sim_i2c.h"
+
+// ============================================================================
+// BENCH STATE
+// ============================================================================
+
+typedef struct {
+    sim_i2c_t          bus;
+    sim_panel_t        panel;
+    union {
+        ssd1306_t      ssd1306;
+        sh1106_t       sh1106;
+    } dev;
+    oled_t            *gfx;         // The driver's own oled_t
+    oled_framebuffer_t fb;
+    oled_shadow_t      shadow;
+    oled_chart_t       chart;
+    int                icon_x;
+} bench_t;
+
+typedef struct {
+    const char *name;
+    int         frames;
+    void      (*setup)(bench_t *b);         // Optional, not counted
+    void      (*frame)(bench_t *b, int n);
+} scenario_t;
+
+// ============================================================================
+// SCENARIOS
+// ============================================================================
+
+// 16x16 icon: a ring with a dot in the middle
+static const uint8_t icon_bits[32] = {
+    0xE0, 0x18, 0x04, 0x02, 0x02, 0x01, 0x81, 0xC1, 0xC1, 0x81, 0x01, 0x02, 0x02, 0x04, 0x18, 0xE0,
+    0x07, 0x18, 0x20, 0x40, 0x40, 0x80, 0x81, 0x83, 0x83, 0x81, 0x80, 0x40, 0x40, 0x20, 0x18, 0x07,
+};
+static const oled_bitmap_t icon = { icon_bits, NULL, 16, 16 };
+
+static void draw_text_page(bench_t *b, int n) {
+    char line[24];
+
+    OLED_CLEAR_BUFFER(b->fb.data);
+    oled_mark_all_dirty(b->gfx);
+    for (int row = 0; row < OLED_NUM_PAGES; row++) {
+        snprintf(line, sizeof(line), row == 3 ? "Frame %6d" : "Status line %d", row == 3 ? n : row);
+        oled_draw_text(b->gfx, b->fb.data, 0, row * OLED_PAGE_HEIGHT, &oled_font_8x8, line);
+    }
+}
+
+static void full_render_frame(bench_t *b, int n) {
+    // Same picture each time: the legacy path sends it regardless
+    (void)n;
+    if (b->panel.controller == SIM_SSD1306) {
+        ssd1306_render_area_t area = SSD1306_FULL_SCREEN_AREA();
+        ssd1306_render(&b->dev.ssd1306, b->fb.data, &area);
+    } else {
+        sh1106_render_full_screen(&b->dev.sh1106, b->fb.data);
+    }
+}
+
+static void full_clear_frame(bench_t *b, int n) {
+    (void)n;
+    OLED_CLEAR_BUFFER(b->fb.data);
+    oled_mark_all_dirty(b->gfx);
+    oled_flush(b->gfx, &b->fb);
+}
+
+static void text_page_frame(bench_t *b, int n) {
+    draw_text_page(b, n);
+    oled_flush(b->gfx, &b->fb);
+}
+
+static void text_page_shadow_setup(bench_t *b) {
+    oled_set_shadow(b->gfx, &b->shadow);
+    draw_text_page(b, 0);
+    oled_flush(b->gfx, &b->fb);
+}
+
+static void counter_frame(bench_t *b, int n) {
+    oled_draw_int(b->gfx, b->fb.data, 48, 24, &oled_font_8x8, n, 6);
+    oled_flush(b->gfx, &b->fb);
+}
+
+static void chart_setup(bench_t *b) {
+    oled_chart_init(b->gfx, &b->chart, 0, 16, OLED_WIDTH, 48, 0, 0);
+}
+
+static void chart_frame(bench_t *b, int n) {
+    // Triangle wave with a little deterministic noise
+    int32_t sample = (n % 64 < 32 ? n % 32 : 32 - n % 32) * 10 + (n * 7919) % 13;
+    oled_chart_push(b->gfx, b->fb.data, &b->chart, sample);
+    oled_flush(b->gfx, &b->fb);
+}
+
+static void icon_setup(bench_t *b) {
+    b->icon_x = 0;
+    oled_blit(b->gfx, b->fb.data, b->icon_x, 24, &icon, OLED_ROP_OR);
+    oled_flush(b->gfx, &b->fb);
+}
+
+static void icon_frame(bench_t *b, int n) {
+    (void)n;
+    oled_clear_area(b->gfx, b->fb.data, b->icon_x, 24, icon.width, icon.height);
+    b->icon_x = (b->icon_x + 2) % (OLED_WIDTH - icon.width);
+    oled_blit(b->gfx, b->fb.data, b->icon_x, 24, &icon, OLED_ROP_OR);
+    oled_flush(b->gfx, &b->fb);
+}
+
+static const scenario_t scenarios[] = {
+    { "full render",       20, NULL,                   full_render_frame },
+    { "full clear",        20, NULL,                   full_clear_frame  },
+    { "text page",         20, NULL,                   text_page_frame   },
+    { "text page+shadow",  20, text_page_shadow_setup, text_page_frame   },
+    { "counter",          100, NULL,                   counter_frame     },
+    { "chart scroll",     256, chart_setup,            chart_frame       },
+    { "icon blit",        100, icon_setup,             icon_frame        },
+};
+
+// ============================================================================
+// RUNNER
+// ============================================================================
+
+static bool bring_up(bench_t *b) {
+    if (b->panel.controller == SIM_SSD1306) {
+        ssd1306_config_t config = ssd1306_create_config(i2c0, 4, 5);
+        if (!ssd1306_init(&b->dev.ssd1306, &config)) return false;
+        b->gfx = &b->dev.ssd1306.gfx;
+    } else {
+        sh1106_config_t config = sh1106_create_config(i2c0, 4, 5);
+        if (!sh1106_init(&b->dev.sh1106, &config)) return false;
+        b->gfx = &b->dev.sh1106.gfx;
+    }
+    return true;
+}
+
+static void run(const scenario_t *s, sim_controller_t controller, sim_i2c_timing_t timing) {
+    static bench_t b;
+
+    // Fresh panel showing a blank framebuffer; none of this is counted
+    memset(&b, 0, sizeof(b));
+    sim_panel_init(&b.panel, controller);
+    sim_i2c_init(&b.bus, timing, &b.panel);
+    if (!bring_up(&b)) {
+        printf("%-18s %-8s init failed\n", s->name, sim_panel_name(&b.panel));
+        return;
+    }
+    OLED_CLEAR_BUFFER(b.fb.data);
+    oled_flush(b.gfx, &b.fb);
+    if (s->setup) s->setup(&b);
+    sim_i2c_reset_counters(&b.bus);
+
+    for (int n = 0; n < s->frames; n++) {
+        s->frame(&b, n);
+    }
+
+    double us = b.bus.bus_us / s->frames;
+    printf("%-18s %-8s %6d %10.1f %8.1f %10.1f %8.1f  %s\n",
+           s->name, sim_panel_name(&b.panel), s->frames,
+           (double)b.bus.bytes / s->frames,
+           (double)b.bus.transactions / s->frames,
+           us, us > 0 ? 1e6 / us : 0.0,
+           sim_panel_matches(&b.panel, b.fb.data) ? "ok" : "MISMATCH");
+}
+
+int main(int argc, char **argv) {
+    sim_i2c_timing_t timing = SIM_I2C_TIMING_400K;
+    if (argc > 1) {
+        uint32_t hz = (uint32_t)strtoul(argv[1], NULL, 10);
+        if (hz == 0) {
+            fprintf(stderr, "usage: %s [scl_hz]\n", argv[0]);
+            return 1;
+        }
+        if (hz <= 100000) timing = SIM_I2C_TIMING_100K;
+        timing.clock_hz = hz;
+    }
+
+    printf("SCL %u Hz, %.1f us START/STOP, %.1f us per write call\n\n",
+           (unsigned)timing.clock_hz, timing.start_stop_us, timing.call_us);
+    printf("%-18s %-8s %6s %10s %8s %10s %8s  %s\n",
+           "scenario", "panel", "frames", "bytes/fr", "txn/fr", "us/fr", "max fps", "panel");
+
+    for (size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++) {
+        run(&scenarios[i], SIM_SSD1306, timing);
+        run(&scenarios[i], SIM_SH1106, timing);
+    }
+    return 0;
+}
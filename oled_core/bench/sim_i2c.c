@@ -0,0 +1,176 @@
+/**
+ * @file sim_i2c.c
+ * @brief Simulated I2C bus and OLED panels implementation
+ * @version 2.0
+ */
+
+#include <string.h>
+#include "sim_i2c.h"
+#include "host_sdk.h"
+
+// ============================================================================
+// PANELS
+// ============================================================================
+
+#define SH1106_COLUMN_OFFSET    2   // Visible columns start here in RAM
+
+// Argument bytes that follow each command; everything else stands alone
+static uint8_t command_args(uint8_t cmd) {
+    switch (cmd) {
+        case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xAD:
+        case 0xD3: case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+            return 1;
+        case 0x21: case 0x22: case 0xA3:
+            return 2;
+        case 0x29: case 0x2A:
+            return 5;
+        case 0x26: case 0x27:
+            return 6;
+        default:
+            return 0;
+    }
+}
+
+static void run_command(sim_panel_t *panel) {
+    uint8_t cmd = panel->cmd;
+
+    if (cmd == 0x20) {
+        panel->mem_mode = panel->args[0] & 0x03;
+    } else if (cmd == 0x21) {
+        panel->col_start = panel->col = panel->args[0];
+        panel->col_end   = panel->args[1];
+    } else if (cmd == 0x22) {
+        panel->page_start = panel->page = panel->args[0] & 0x07;
+        panel->page_end   = panel->args[1] & 0x07;
+    } else if (cmd <= 0x0F) {
+        panel->col = (uint8_t)((panel->col & 0xF0) | cmd);
+    } else if (cmd <= 0x1F) {
+        panel->col = (uint8_t)((panel->col & 0x0F) | ((cmd & 0x0F) << 4));
+    } else if (cmd >= 0xB0 && cmd <= 0xB7) {
+        panel->page = cmd & 0x07;
+    } else if (cmd >= 0x40 && cmd <= 0x7F) {
+        panel->start_line = cmd & 0x3F;
+    }
+    // Everything else changes how RAM is shown, not what it holds
+}
+
+static void receive_command(sim_panel_t *panel, uint8_t byte) {
+    if (panel->args_got < panel->args_needed) {
+        panel->args[panel->args_got++] = byte;
+    } else {
+        panel->cmd         = byte;
+        panel->args_got    = 0;
+        panel->args_needed = command_args(byte);
+    }
+    if (panel->args_got == panel->args_needed) run_command(panel);
+}
+
+static void receive_data(sim_panel_t *panel, uint8_t byte) {
+    if (panel->controller == SIM_SH1106) {
+        // Page addressing: the column counter stops at the end of RAM
+        if (panel->col < SIM_PANEL_RAM_WIDTH) panel->ram[panel->page][panel->col++] = byte;
+        return;
+    }
+
+    if (panel->col < OLED_WIDTH) panel->ram[panel->page][panel->col] = byte;
+    if (panel->mem_mode != 0) {
+        if (panel->col < OLED_WIDTH - 1) panel->col++;
+        return;
+    }
+
+    // Horizontal addressing: wrap within the window, page by page
+    if (panel->col++ < panel->col_end) return;
+    panel->col = panel->col_start;
+    panel->page = panel->page < panel->page_end ? panel->page + 1 : panel->page_start;
+}
+
+void sim_panel_init(sim_panel_t *panel, sim_controller_t controller) {
+    memset(panel, 0, sizeof(*panel));
+    panel->controller = controller;
+    panel->mem_mode   = 2;          // Page addressing after reset
+    panel->col_end    = OLED_WIDTH - 1;
+    panel->page_end   = OLED_NUM_PAGES - 1;
+}
+
+const char *sim_panel_name(const sim_panel_t *panel) {
+    return panel->controller == SIM_SSD1306 ? "ssd1306" : "sh1106";
+}
+
+void sim_panel_receive(sim_panel_t *panel, const uint8_t *data, size_t len) {
+    // Control byte: Co = 1 covers one byte and another control byte follows,
+    // Co = 0 covers the rest of the transaction. D/C picks data or command.
+    size_t i = 0;
+    while (i < len) {
+        uint8_t control = data[i++];
+        bool    single  = control & 0x80;
+        bool    is_data = control & 0x40;
+
+        size_t end = single ? (i + 1 < len ? i + 1 : len) : len;
+        for (; i < end; i++) {
+            if (is_data) receive_data(panel, data[i]);
+            else         receive_command(panel, data[i]);
+        }
+    }
+}
+
+uint8_t sim_panel_shown(const sim_panel_t *panel, int height, int page, int col) {
+    int offset = panel->controller == SIM_SH1106 ? SH1106_COLUMN_OFFSET : 0;
+    uint8_t byte = 0;
+
+    if (page * 8 >= height) return 0;
+    for (int bit = 0; bit < 8; bit++) {
+        int row = (panel->start_line + page * 8 + bit) % OLED_HEIGHT;
+        if (panel->ram[row / 8][col + offset] & (1 << (row % 8))) byte |= (uint8_t)(1 << bit);
+    }
+    return byte;
+}
+
+bool sim_panel_matches(const sim_panel_t *panel, const uint8_t *buf) {
+    int offset = panel->controller == SIM_SH1106 ? SH1106_COLUMN_OFFSET : 0;
+
+    for (int page = 0; page < OLED_NUM_PAGES; page++) {
+        if (memcmp(&panel->ram[page][offset], &buf[page * OLED_WIDTH], OLED_WIDTH) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ============================================================================
+// BUS
+// ============================================================================
+
+static int bus_receive(void *ctx, i2c_inst_t *i2c, uint8_t addr, const uint8_t *data, size_t len) {
+    sim_i2c_t *bus = (sim_i2c_t *)ctx;
+    (void)i2c;
+    (void)addr;
+
+    sim_i2c_write(bus, len);
+    if (bus->panel) sim_panel_receive(bus->panel, data, len);
+    return (int)len;
+}
+
+void sim_i2c_init(sim_i2c_t *bus, sim_i2c_timing_t timing, sim_panel_t *panel) {
+    bus->timing = timing;
+    bus->panel  = panel;
+    sim_i2c_reset_counters(bus);
+
+    host_sdk_reset();
+    host_i2c_set_handler(bus_receive, bus);
+}
+
+void sim_i2c_reset_counters(sim_i2c_t *bus) {
+    bus->bytes        = 0;
+    bus->transactions = 0;
+    bus->bus_us       = 0.0;
+}
+
+void sim_i2c_write(sim_i2c_t *bus, size_t len) {
+    // Address byte + payload, 9 clocks each
+    double bits = 9.0 * (1 + len);
+
+    bus->bytes        += (uint32_t)len;
+    bus->transactions += 1;
+    bus->bus_us       += bits * 1e6 / bus->timing.clock_hz
+                       + bus->timing.start_stop_us + bus->timing.call_us;
+}
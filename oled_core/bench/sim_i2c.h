@@ -0,0 +1,100 @@
+/**
+ * @file sim_i2c.h
+ * @brief Simulated I2C bus and OLED panels for host-side benchmarks
+ * @version 2.0
+ *
+ * The real ssd1306 and sh1106 drivers run against the host SDK stand-ins
+ * (host/sdk); every transaction they put on the bus lands here, is costed,
+ * and is decoded by a model of the panel on the other end.
+ *
+ * A write of n bytes is one transaction of START, the address byte, n data
+ * bytes and STOP, each byte taking 9 SCL cycles (8 bits plus ACK). Fixed
+ * costs per transaction cover the START/STOP conditions with their bus-free
+ * time and the SDK call that sets the write up.
+ *
+ * The panel models interpret control bytes, commands and data the way the
+ * controllers do and keep panel RAM, so a benchmark can check that what
+ * arrived matches the framebuffer.
+ */
+
+#ifndef SIM_I2C_H
+#define SIM_I2C_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "oled_core.h"
+
+// ============================================================================
+// PANELS
+// ============================================================================
+
+#define SIM_PANEL_RAM_WIDTH 132     // SH1106 RAM; the SSD1306 uses 128 of it
+
+typedef enum {
+    SIM_SSD1306,    // Windowed writes: one command list, one data write
+    SIM_SH1106      // Page addressing: three single-command writes per page
+} sim_controller_t;
+
+typedef struct {
+    sim_controller_t controller;
+
+    uint8_t ram[OLED_NUM_PAGES][SIM_PANEL_RAM_WIDTH];
+
+    // Addressing state set by commands
+    uint8_t mem_mode;               // SSD1306: 0 horizontal, 2 page
+    uint8_t col, page;              // Write cursor
+    uint8_t col_start, col_end;     // SSD1306 window
+    uint8_t page_start, page_end;
+    uint8_t start_line;             // RAM row shown at the top
+
+    // Command in progress across bytes (and transactions)
+    uint8_t cmd;
+    uint8_t args[6];
+    uint8_t args_got;
+    uint8_t args_needed;
+} sim_panel_t;
+
+void sim_panel_init(sim_panel_t *panel, sim_controller_t controller);
+const char *sim_panel_name(const sim_panel_t *panel);
+
+// One transaction as the controller receives it
+void sim_panel_receive(sim_panel_t *panel, const uint8_t *data, size_t len);
+
+// Byte the panel shows at screen page `page`, column col, of a panel
+// `height` rows tall: RAM read from the start line on, wrapping at 64 rows
+uint8_t sim_panel_shown(const sim_panel_t *panel, int height, int page, int col);
+
+// True if the visible part of panel RAM holds exactly buf (unrotated canvas)
+bool sim_panel_matches(const sim_panel_t *panel, const uint8_t *buf);
+
+// ============================================================================
+// BUS
+// ============================================================================
+
+typedef struct {
+    uint32_t clock_hz;          // SCL frequency
+    float    start_stop_us;     // START + STOP conditions and bus-free time
+    float    call_us;           // Software overhead per i2c_write_blocking()
+} sim_i2c_timing_t;
+
+// Fast-mode minimums: tHD;STA + tSU;STA + tSU;STO + tBUF = 3.1 us
+#define SIM_I2C_TIMING_400K  ((sim_i2c_timing_t){ 400000, 3.1f, 2.0f })
+// Standard mode: 4.0 + 4.7 + 4.0 + 4.7 us
+#define SIM_I2C_TIMING_100K  ((sim_i2c_timing_t){ 100000, 17.4f, 2.0f })
+
+typedef struct {
+    sim_i2c_timing_t timing;
+    sim_panel_t     *panel;         // Device answering on the bus
+    uint32_t         bytes;         // Bytes after the address byte
+    uint32_t         transactions;
+    double           bus_us;        // Estimated time the writes kept the caller busy
+} sim_i2c_t;
+
+// Resets the host SDK and routes every I2C transaction to bus and panel
+void sim_i2c_init(sim_i2c_t *bus, sim_i2c_timing_t timing, sim_panel_t *panel);
+void sim_i2c_reset_counters(sim_i2c_t *bus);
+
+// Cost of one transaction of len bytes (control byte included)
+void sim_i2c_write(sim_i2c_t *bus, size_t len);
+
+#endif // SIM_I2C_H
@@ -0,0 +1,73 @@
+/**
+ * @file oled_chart.h
+ * @brief Rolling time-series chart widget for oled_core framebuffers
+ * @version 1.0
+ *
+ * One sample per column, newest on the right. Samples live in a fixed ring
+ * buffer inside the chart, so there is no allocation. Pushing a sample
+ * scrolls the chart area one column left in place and draws only the new
+ * column; the whole chart is redrawn only when the auto-scale range
+ * changes. Only the chart area is marked dirty.
+ *
+ * Usage:
+ *   static oled_chart_t chart;
+ *   oled_chart_init(&dev.gfx, &chart, 0, 16, 128, 48, 0, 0);  // min == max: auto-scale
+ *   // per sample
+ *   oled_chart_push(&dev.gfx, fb.data, &chart, current_ma);
+ *   ssd1306_flush(&dev, &fb);
+ */
+
+#ifndef OLED_CHART_H
+#define OLED_CHART_H
+
+#include "oled_core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// CHART STATE
+// ============================================================================
+
+typedef struct {
+    // Screen area, clipped to the canvas by oled_chart_init
+    int16_t x, y;
+    uint8_t width, height;
+
+    // Ring buffer, one sample per column; head is the next slot to write
+    int32_t samples[OLED_WIDTH];
+    uint8_t head;
+    uint8_t count;
+
+    // Value range mapped to the bottom and top rows
+    int32_t min, max;
+    bool    auto_scale;
+} oled_chart_t;
+
+// ============================================================================
+// FUNCTION DECLARATIONS
+// ============================================================================
+
+// Sets up an empty chart on gfx's current canvas. With min == max the
+// range follows the smallest and largest sample on screen; otherwise it is
+// fixed and samples outside it are drawn clamped to the edge rows.
+void oled_chart_init(const oled_t *gfx, oled_chart_t *chart, int x, int y, int width, int height,
+                     int32_t min, int32_t max);
+
+// Adds a sample: scrolls the chart one column and draws the newest column,
+// or redraws everything if the auto-scale range changed.
+void oled_chart_push(oled_t *gfx, uint8_t *buf, oled_chart_t *chart, int32_t sample);
+
+// Redraws the whole chart from the ring buffer, e.g. after the screen was
+// cleared.
+void oled_chart_redraw(oled_t *gfx, uint8_t *buf, oled_chart_t *chart);
+
+// Empties the ring buffer and clears the chart area.
+void oled_chart_clear(oled_t *gfx, uint8_t *buf, oled_chart_t *chart);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OLED_CHART_H
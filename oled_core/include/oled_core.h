@@ -0,0 +1,325 @@
+/**
+ * @file oled_core.h
+ * @brief Controller-agnostic framebuffer and graphics core for OLEDs up to 128x64
+ * @version 1.0
+ *
+ * Shared by the SSD1306 and SH1106 drivers. Both panels use the same
+ * page-format buffer (one byte = 8 vertical pixels, bit 0 on top), so every
+ * raster kernel and the dirty tracking live here once. A driver supplies an
+ * oled_backend_t that knows how to talk to its controller.
+ *
+ * The core has no SDK dependencies and builds on the host as well, e.g.
+ * against a simulated panel backend.
+ */
+
+#ifndef OLED_CORE_H
+#define OLED_CORE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "oled_font.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// GEOMETRY
+// ============================================================================
+
+#define OLED_HEIGHT         64
+#define OLED_WIDTH          128
+#define OLED_PAGE_HEIGHT    8
+#define OLED_NUM_PAGES      (OLED_HEIGHT / OLED_PAGE_HEIGHT)
+#define OLED_BUF_LEN        (OLED_NUM_PAGES * OLED_WIDTH)
+
+// Pages of the tallest canvas: 128 rows when rotated by 90/270
+#define OLED_MAX_PAGES      (OLED_WIDTH / OLED_PAGE_HEIGHT)
+
+// OLED_WIDTH x OLED_HEIGHT is the largest panel and sizes every buffer.
+// Smaller panels (128x32, 72x40, ...) are set with oled_set_geometry(); the
+// canvas then uses the first width * height / 8 bytes of the buffer.
+
+// Canvas rotation, clockwise. At 90/270 the canvas is as wide as the panel
+// is tall and vice versa; the framebuffer keeps its size but holds that
+// portrait canvas in the same page format (oled_t.width bytes per page).
+typedef enum {
+    OLED_ROTATE_0,
+    OLED_ROTATE_90,
+    OLED_ROTATE_180,
+    OLED_ROTATE_270,
+} oled_rotation_t;
+
+// ============================================================================
+// FRAMEBUFFER
+// ============================================================================
+
+// Caller-owned framebuffer with a spare byte in front of the pixel data.
+// Backends write the 0x40 data control byte into the byte preceding
+// whatever slice they transmit, so frames go out without a staging copy.
+// Draw into fb.data exactly like a plain OLED_BUF_LEN buffer. The pixel
+// data is word-aligned so the flush can compare it 32 bits at a time.
+typedef struct {
+    uint8_t reserved[3];
+    uint8_t control;
+    union {
+        uint8_t  data[OLED_BUF_LEN];
+        uint32_t words[OLED_BUF_LEN / 4];
+    };
+} oled_framebuffer_t;
+
+// Optional copy of what the panel currently shows, in panel layout. With a
+// shadow attached, oled_flush() compares each dirty span against it word
+// by word and sends only the runs that really changed.
+typedef struct {
+    uint32_t words[OLED_BUF_LEN / 4];
+} oled_shadow_t;
+
+// ============================================================================
+// CONTROLLER BACKEND
+// ============================================================================
+
+typedef struct {
+    // Send the controller's init sequence. Bus setup is the driver's job.
+    // Returns false if the panel did not answer.
+    bool (*init)(void *ctx);
+
+    // Point the controller's write cursor at columns [start_col, end_col]
+    // of one page. Column 0 is the first visible column.
+    void (*set_window)(void *ctx, uint8_t page, uint8_t start_col, uint8_t end_col);
+
+    // Send len bytes of pixel data to the current window.
+    // data always points into an oled_framebuffer_t, so data[-1] may be
+    // borrowed for the control byte as long as it is restored.
+    void (*send_data)(void *ctx, uint8_t *data, int len);
+
+    // Optional. Block until an in-flight asynchronous transfer is done.
+    // Called before the core modifies a buffer while oled_t.busy is set.
+    void (*wait_idle)(void *ctx);
+
+    // Optional. Mirror the panel horizontally (segment remap) and/or
+    // vertically (COM scan direction). Needed for 90/180/270 rotation.
+    void (*set_flip)(void *ctx, bool flip_x, bool flip_y);
+
+    // Optional. Panel contrast, i.e. brightness and most of its current.
+    void (*set_contrast)(void *ctx, uint8_t contrast);
+
+    // Optional. Switch the panel on or off (sleep); RAM is kept while off.
+    void (*set_display_on)(void *ctx, bool on);
+} oled_backend_t;
+
+// ============================================================================
+// CORE STATE
+// ============================================================================
+
+typedef struct {
+    const oled_backend_t *backend;
+    void                 *ctx;
+
+    // Set by backends while an asynchronous transfer reads the framebuffer
+    volatile bool         busy;
+
+    // Last-sent frame for diffing; only trusted once shadow_valid is set
+    oled_shadow_t        *shadow;
+    bool                  shadow_valid;
+
+    // Panel size before rotation (see oled_set_geometry)
+    uint8_t               panel_width;
+    uint8_t               panel_height;
+
+    // Canvas as drawn, after rotation (see oled_set_rotation)
+    oled_rotation_t       rotation;
+    uint8_t               width;
+    uint8_t               height;
+
+    // Dirty tracking: per canvas page, the inclusive column span touched
+    // since the last flush. A page is clean when dirty_start > dirty_end.
+    uint8_t               dirty_start[OLED_MAX_PAGES];
+    uint8_t               dirty_end[OLED_MAX_PAGES];
+} oled_t;
+
+// True at 90/270, where the canvas is transposed on its way to the panel
+static inline bool oled_is_transposed(const oled_t *gfx) {
+    return gfx->rotation == OLED_ROTATE_90 || gfx->rotation == OLED_ROTATE_270;
+}
+
+// ============================================================================
+// BITMAPS
+// ============================================================================
+
+// A page-format image: ceil(height / 8) page rows of `width` bytes back to
+// back, bit 0 on top - the same layout as the framebuffer and the fonts.
+// The optional mask has the same layout; a 1 marks pixels that belong to
+// the image, everything else is left untouched by every raster op.
+typedef struct {
+    const uint8_t *bits;
+    const uint8_t *mask;    // NULL: every pixel inside width x height
+    uint8_t        width;
+    uint8_t        height;
+} oled_bitmap_t;
+
+// How image pixels combine with the framebuffer (within the mask)
+typedef enum {
+    OLED_ROP_COPY,          // dst = src
+    OLED_ROP_OR,            // set where src is 1 (transparent background)
+    OLED_ROP_AND,           // clear where src is 0
+    OLED_ROP_XOR,           // invert where src is 1 (e.g. cursors, selection)
+} oled_rop_t;
+
+// ============================================================================
+// LABELS
+// ============================================================================
+
+// Size limits of a pre-rendered label; override before including to taste
+#ifndef OLED_LABEL_MAX_WIDTH
+#define OLED_LABEL_MAX_WIDTH    64
+#endif
+#ifndef OLED_LABEL_MAX_PAGES
+#define OLED_LABEL_MAX_PAGES    2
+#endif
+
+// A string rendered once into a page-format bitmap (page rows of `width`
+// bytes back to back), for static text redrawn every frame. Drawing it at
+// a page-aligned y is one memcpy per page row.
+typedef struct {
+    uint8_t width;      // Columns in use
+    uint8_t pages;      // Page rows in use
+    uint8_t bits[OLED_LABEL_MAX_PAGES * OLED_LABEL_MAX_WIDTH];
+} oled_label_t;
+
+// ============================================================================
+// BUFFER MACROS
+// ============================================================================
+
+#define OLED_CLEAR_BUFFER(buf) memset(buf, 0x00, OLED_BUF_LEN)
+#define OLED_FILL_BUFFER(buf)  memset(buf, 0xFF, OLED_BUF_LEN)
+
+// ============================================================================
+// FUNCTION DECLARATIONS
+// ============================================================================
+
+// Setup
+// Attaches a backend and marks the whole screen dirty. Rotation starts at 0,
+// geometry at OLED_WIDTH x OLED_HEIGHT.
+void oled_bind(oled_t *gfx, const oled_backend_t *backend, void *ctx);
+
+// Geometry
+// Panel size before rotation, for panels smaller than OLED_WIDTH x
+// OLED_HEIGHT; drivers call it from init. Both sides must be multiples of 8.
+// Returns false (and changes nothing) for a size the core cannot hold.
+bool oled_set_geometry(oled_t *gfx, uint8_t width, uint8_t height);
+
+// Rotation
+// 180 is done by the controller; 90/270 draw on a portrait canvas that is
+// transposed 8x8 block by block while flushing. Changing between landscape
+// and portrait changes the buffer layout, so redraw everything afterwards.
+// Returns false if the backend cannot mirror the panel.
+bool oled_set_rotation(oled_t *gfx, oled_rotation_t rotation);
+
+// Display control
+// Return false if the backend does not support the call. oled_reinit()
+// repeats the init sequence after the panel lost power, restores rotation
+// and marks everything dirty so the next flush repaints it.
+bool oled_set_contrast(oled_t *gfx, uint8_t contrast);
+bool oled_display_on(oled_t *gfx, bool on);
+bool oled_reinit(oled_t *gfx);
+
+// Drawing into a buffer that an asynchronous transfer is still reading would
+// tear the frame, so every drawing call lets the backend finish first.
+// Code that writes the buffer directly should do the same.
+static inline void oled_wait_idle(oled_t *gfx) {
+    if (gfx->busy && gfx->backend->wait_idle) gfx->backend->wait_idle(gfx->ctx);
+}
+
+// Dirty tracking
+// Graphics calls mark what they touch. Code that writes the buffer directly
+// (e.g. OLED_CLEAR_BUFFER) must call oled_mark_dirty/mark_all_dirty.
+void oled_mark_dirty(oled_t *gfx, int x0, int y0, int x1, int y1);
+void oled_mark_all_dirty(oled_t *gfx);
+void oled_clear_dirty(oled_t *gfx);
+bool oled_is_dirty(const oled_t *gfx);
+void oled_flush(oled_t *gfx, oled_framebuffer_t *fb);
+
+// Flush at most about max_bytes of pixel data (0: no limit), whole dirty
+// pages in order. At least one page goes out per call; the pages that did
+// not fit stay dirty for the next call. Returns the pixel bytes sent.
+int  oled_flush_budget(oled_t *gfx, oled_framebuffer_t *fb, int max_bytes);
+
+// oled_flush_budget() for a buffer sized to the panel rather than an
+// oled_framebuffer_t. data must be word-aligned with a writable byte in
+// front of it, i.e. laid out like oled_framebuffer_t.data.
+int  oled_flush_data(oled_t *gfx, uint8_t *data, int max_bytes);
+
+// Shadow frame
+// Attach caller-owned storage (NULL detaches). The next flush sends every
+// dirty span and fills the shadow; after that flushes send only bytes that
+// differ, so a buffer cleared and redrawn each frame (then mark_all_dirty)
+// costs no more than what changed. Drivers that write panel RAM behind the
+// core's back must store what they sent or invalidate the shadow.
+void oled_set_shadow(oled_t *gfx, oled_shadow_t *shadow);
+void oled_shadow_store(oled_t *gfx, int page, int col, const uint8_t *data, int len);
+void oled_shadow_invalidate(oled_t *gfx);
+
+// Panel view, for backends that send frames themselves: the dirty span of
+// each panel page in controller columns, and the bytes of one panel page
+// (buf's own row, or the transposed row built in scratch[OLED_WIDTH]).
+void oled_panel_dirty(const oled_t *gfx, uint8_t start[OLED_NUM_PAGES], uint8_t end[OLED_NUM_PAGES]);
+const uint8_t *oled_panel_page(const oled_t *gfx, const uint8_t *buf, int page, uint8_t *scratch);
+
+// Graphics
+void oled_set_pixel(oled_t *gfx, uint8_t *buf, int x, int y, bool on);
+void oled_draw_line(oled_t *gfx, uint8_t *buf, int x0, int y0, int x1, int y1, bool on);
+void oled_draw_hline(oled_t *gfx, uint8_t *buf, int x, int y, int w, bool on);
+void oled_draw_vline(oled_t *gfx, uint8_t *buf, int x, int y, int h, bool on);
+void oled_draw_rect(oled_t *gfx, uint8_t *buf, int x, int y, int w, int h, bool on);
+void oled_fill_rect(oled_t *gfx, uint8_t *buf, int x, int y, int w, int h, bool on);
+void oled_clear_area(oled_t *gfx, uint8_t *buf, int x, int y, int w, int h);
+
+// Bitmaps
+// Draws at any x/y, clipped to the screen, a few shifted byte ops per column.
+void oled_blit(oled_t *gfx, uint8_t *buf, int x, int y, const oled_bitmap_t *bmp, oled_rop_t rop);
+
+// Text (any font)
+// x/y is the top-left corner; glyphs are clipped at the screen edges.
+// draw_glyph returns the advance, draw_text the x after the last glyph.
+// Strings may carry the unit symbols as OLED_STR_* codes or as UTF-8.
+int  oled_draw_glyph(oled_t *gfx, uint8_t *buf, int x, int y, const oled_font_t *font, uint8_t ch);
+int  oled_draw_text(oled_t *gfx, uint8_t *buf, int x, int y, const oled_font_t *font, const char *str);
+void oled_draw_text_centered(oled_t *gfx, uint8_t *buf, int y, const oled_font_t *font, const char *str);
+int  oled_text_width(const oled_font_t *font, const char *str);
+
+// Numbers (any font), without printf
+// value is fixed-point: draw_fixed(..., 1234, 2, ...) shows "12.34". The
+// number is right-aligned in a field of `width` digit cells starting at x,
+// and the field is cleared first, so a changing readout never leaves stale
+// digits behind. A number that does not fit fills the field with '#'.
+// width 0 draws the number at x with no field.
+void oled_draw_fixed(oled_t *gfx, uint8_t *buf, int x, int y, const oled_font_t *font,
+                     int32_t value, uint8_t decimals, uint8_t width);
+void oled_draw_int(oled_t *gfx, uint8_t *buf, int x, int y, const oled_font_t *font,
+                   int32_t value, uint8_t width);
+
+// Labels
+// label_init renders str once; it returns false if the text was cut to fit
+// OLED_LABEL_MAX_WIDTH/MAX_PAGES. draw_label is opaque: it replaces the
+// whole width x pages*8 cell, so an old label underneath needs no clearing.
+bool oled_label_init(oled_label_t *label, const oled_font_t *font, const char *str);
+void oled_draw_label(oled_t *gfx, uint8_t *buf, int x, int y, const oled_label_t *label);
+
+// Text (8x8 font, drivers' classic API)
+// Characters that would not fit entirely on screen are skipped.
+void oled_write_char(oled_t *gfx, uint8_t *buf, int16_t x, int16_t y, uint8_t ch);
+void oled_write_string(oled_t *gfx, uint8_t *buf, int16_t x, int16_t y, const char *str);
+void oled_write_centered(oled_t *gfx, uint8_t *buf, int16_t y, const char *str);
+void oled_write_lines(oled_t *gfx, uint8_t *buf, int16_t x, int16_t y,
+                      const char **lines, int line_count, int line_spacing);
+void oled_write_fixed(oled_t *gfx, uint8_t *buf, int16_t x, int16_t y,
+                      int32_t value, uint8_t decimals, uint8_t width);
+void oled_write_int(oled_t *gfx, uint8_t *buf, int16_t x, int16_t y, int32_t value, uint8_t width);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OLED_CORE_H
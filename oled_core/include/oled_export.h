@@ -0,0 +1,43 @@
+/**
+ * @file oled_export.h
+ * @brief Framebuffer snapshots as PBM images
+ * @version 1.0
+ *
+ * Converts a page-format buffer to a binary PBM (P4) image of the canvas,
+ * rotation included, so a screen can be looked at and compared without a
+ * panel. The image is produced a row at a time through a write callback,
+ * with no buffer of its own, so it can go straight to a file, a TCP socket,
+ * BLE notifications or an SD card. Lit pixels are black (PBM 1) on white.
+ *
+ * Usage:
+ *   static bool ble_write(void *ctx, const uint8_t *data, size_t len) {
+ *       return ble_nordic_uart_send_bytes(data, len);
+ *   }
+ *   oled_export_pbm(&dev.gfx, fb.data, ble_write, NULL);
+ */
+
+#ifndef OLED_EXPORT_H
+#define OLED_EXPORT_H
+
+#include <stddef.h>
+#include "oled_core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Receives consecutive pieces of the image, at most 16 bytes each (the
+// header, then one row of pixels). Return false to abort the export.
+typedef bool (*oled_write_fn_t)(void *ctx, const uint8_t *data, size_t len);
+
+// Size of the whole PBM file for gfx's current canvas
+size_t oled_pbm_size(const oled_t *gfx);
+
+// Write buf as a PBM image. Returns false if write failed.
+bool oled_export_pbm(const oled_t *gfx, const uint8_t *buf, oled_write_fn_t write, void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OLED_EXPORT_H
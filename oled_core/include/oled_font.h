@@ -0,0 +1,82 @@
+/**
+ * @file oled_font.h
+ * @brief Bitmap font descriptors for oled_core
+ * @version 1.0
+ *
+ * Glyphs are stored in framebuffer page format: each byte is one column of
+ * 8 vertical pixels, bit 0 on top. A glyph taller than 8 pixels is stored
+ * as consecutive page rows, each `width` bytes long, so drawing a glyph is
+ * a handful of (possibly shifted) byte ORs per column.
+ *
+ * Character lookup goes through a 256-entry table built at compile time,
+ * so finding a glyph is one array read per character. Characters a font
+ * does not have show as a hollow box rather than some other glyph.
+ */
+
+#ifndef OLED_FONT_H
+#define OLED_FONT_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    const uint8_t  *bitmaps;    // Glyph data, page rows of each glyph back to back
+    const uint16_t *offsets;    // Start of each glyph in bitmaps (NULL: fixed stride)
+    const uint8_t  *widths;     // Columns of each glyph (NULL: all are `width` wide)
+    const uint8_t  *index;      // 256 entries: character code -> glyph number
+    uint8_t         width;      // Widest glyph, in columns
+    uint8_t         height;     // Glyph height in pixels
+    uint8_t         spacing;    // Blank columns after each glyph
+} oled_font_t;
+
+// ============================================================================
+// UNIT SYMBOLS
+// ============================================================================
+
+// Character codes for the non-ASCII symbols. Degree and micro are their
+// Latin-1 codes; ohm has none and takes the unused DEL slot. Build strings
+// with the OLED_STR_* pieces ("25" OLED_STR_DEGREE "C") or type the UTF-8
+// characters directly - the text functions accept both.
+#define OLED_CHAR_DEGREE    0xB0
+#define OLED_CHAR_MICRO     0xB5
+#define OLED_CHAR_OHM       0x7F
+
+#define OLED_STR_DEGREE     "\xB0"
+#define OLED_STR_MICRO      "\xB5"
+#define OLED_STR_OHM        "\x7F"
+
+// ============================================================================
+// BUILT-IN FONTS
+// ============================================================================
+
+extern const oled_font_t oled_font_5x7;     // Proportional, printable ASCII
+extern const oled_font_t oled_font_8x8;     // Fixed 8x8, the drivers' default
+extern const oled_font_t oled_font_12x16;   // Large digits for readouts
+
+// ============================================================================
+// GLYPH LOOKUP
+// ============================================================================
+
+static inline int oled_font_pages(const oled_font_t *font) {
+    return (font->height + 7) / 8;
+}
+
+static inline int oled_font_glyph_width(const oled_font_t *font, uint8_t ch) {
+    return font->widths ? font->widths[font->index[ch]] : font->width;
+}
+
+static inline const uint8_t *oled_font_glyph(const oled_font_t *font, uint8_t ch) {
+    uint8_t glyph = font->index[ch];
+    if (font->offsets) return font->bitmaps + font->offsets[glyph];
+    return font->bitmaps + (size_t)glyph * font->width * oled_font_pages(font);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OLED_FONT_H
@@ -0,0 +1,170 @@
+/**
+ * @file oled_chart.c
+ * @brief Rolling time-series chart widget implementation
+ * @version 1.0
+ */
+
+#include "oled_chart.h"
+#include <stdlib.h>
+
+// ============================================================================
+// INTERNAL
+// ============================================================================
+
+// Sample by age, 0 being the newest
+static inline int32_t sample_at(const oled_chart_t *chart, int age) {
+    int idx = chart->head - 1 - age;
+    if (idx < 0) idx += chart->width;
+    return chart->samples[idx];
+}
+
+static int value_row(const oled_chart_t *chart, int32_t value) {
+    int bottom = chart->y + chart->height - 1;
+
+    // Flat range: draw along the middle
+    if (chart->max == chart->min) return bottom - (chart->height - 1) / 2;
+    if (value <= chart->min) return bottom;
+    if (value >= chart->max) return chart->y;
+
+    int64_t span = (int64_t)chart->max - chart->min;
+    return bottom - (int)(((int64_t)value - chart->min) * (chart->height - 1) / span);
+}
+
+// One column per sample, joined to the previous sample's row so steep
+// changes still read as a line
+static void draw_column(oled_t *gfx, uint8_t *buf, const oled_chart_t *chart, int age) {
+    int col = chart->x + chart->width - 1 - age;
+    int r1  = value_row(chart, sample_at(chart, age));
+    int r0  = age + 1 < chart->count ? value_row(chart, sample_at(chart, age + 1)) : r1;
+
+    oled_draw_vline(gfx, buf, col, r0 < r1 ? r0 : r1, abs(r1 - r0) + 1, true);
+}
+
+// Move the chart area one column left in place. Pages that are only partly
+// inside the area keep their outside rows.
+static void scroll_left(oled_t *gfx, uint8_t *buf, const oled_chart_t *chart) {
+    int x  = chart->x, w = chart->width;
+    int y0 = chart->y, y1 = chart->y + chart->height - 1;
+
+    oled_wait_idle(gfx);
+    oled_mark_dirty(gfx, x, y0, x + w - 1, y1);
+
+    for (int page = y0 >> 3; page <= y1 >> 3; page++) {
+        uint8_t mask = 0xFF;
+        if (page == y0 >> 3) mask &= (uint8_t)(0xFF << (y0 & 7));
+        if (page == y1 >> 3) mask &= (uint8_t)(0xFF >> (7 - (y1 & 7)));
+
+        uint8_t *row = buf + page * gfx->width + x;
+        if (mask == 0xFF) {
+            memmove(row, row + 1, w - 1);
+        } else {
+            for (int c = 0; c < w - 1; c++) {
+                row[c] = (uint8_t)((row[c] & ~mask) | (row[c + 1] & mask));
+            }
+        }
+    }
+
+    oled_clear_area(gfx, buf, x + w - 1, y0, 1, chart->height);
+}
+
+// Full min/max scan; only needed when the sample that scrolled out was an
+// extreme. Returns true if the range changed.
+static bool rescan_range(oled_chart_t *chart) {
+    int32_t lo = sample_at(chart, 0), hi = lo;
+    for (int age = 1; age < chart->count; age++) {
+        int32_t v = sample_at(chart, age);
+        if (v < lo) lo = v;
+        if (v > hi) hi = v;
+    }
+
+    bool changed = lo != chart->min || hi != chart->max;
+    chart->min = lo;
+    chart->max = hi;
+    return changed;
+}
+
+// ============================================================================
+// CHART
+// ============================================================================
+
+void oled_chart_init(const oled_t *gfx, oled_chart_t *chart, int x, int y, int width, int height,
+                     int32_t min, int32_t max) {
+    if (x < 0) { width  += x; x = 0; }
+    if (y < 0) { height += y; y = 0; }
+    if (x > gfx->width)  x = gfx->width;
+    if (y > gfx->height) y = gfx->height;
+    if (x + width  > gfx->width)  width  = gfx->width - x;
+    if (y + height > gfx->height) height = gfx->height - y;
+    if (width  < 0) width  = 0;
+    if (height < 0) height = 0;
+
+    chart->x          = (int16_t)x;
+    chart->y          = (int16_t)y;
+    chart->width      = (uint8_t)width;
+    chart->height     = (uint8_t)height;
+    chart->head       = 0;
+    chart->count      = 0;
+    chart->auto_scale = min == max;
+    chart->min        = min < max ? min : max;
+    chart->max        = min < max ? max : min;
+}
+
+void oled_chart_push(oled_t *gfx, uint8_t *buf, oled_chart_t *chart, int32_t sample) {
+    if (chart->width == 0 || chart->height == 0) return;
+
+    bool    full    = chart->count == chart->width;
+    int32_t dropped = chart->samples[chart->head];
+
+    chart->samples[chart->head] = sample;
+    chart->head = (uint8_t)((chart->head + 1) % chart->width);
+    if (!full) chart->count++;
+
+    // Growing the range is O(1); only losing an extreme needs a scan
+    bool rescaled = false;
+    if (chart->auto_scale) {
+        if (chart->count == 1) {
+            chart->min = chart->max = sample;
+            rescaled = true;
+        } else if (full && (dropped == chart->min || dropped == chart->max)) {
+            rescaled = rescan_range(chart);
+        } else if (sample < chart->min) {
+            chart->min = sample;
+            rescaled = true;
+        } else if (sample > chart->max) {
+            chart->max = sample;
+            rescaled = true;
+        }
+    }
+
+    if (rescaled) {
+        oled_chart_redraw(gfx, buf, chart);
+        return;
+    }
+
+    scroll_left(gfx, buf, chart);
+    draw_column(gfx, buf, chart, 0);
+
+    // The oldest column was joined to the sample that just left; redraw it
+    // on its own so the chart matches a full redraw
+    if (full) {
+        oled_clear_area(gfx, buf, chart->x, chart->y, 1, chart->height);
+        draw_column(gfx, buf, chart, chart->count - 1);
+    }
+}
+
+void oled_chart_redraw(oled_t *gfx, uint8_t *buf, oled_chart_t *chart) {
+    if (chart->width == 0 || chart->height == 0) return;
+
+    oled_clear_area(gfx, buf, chart->x, chart->y, chart->width, chart->height);
+    for (int age = chart->count - 1; age >= 0; age--) {
+        draw_column(gfx, buf, chart, age);
+    }
+}
+
+void oled_chart_clear(oled_t *gfx, uint8_t *buf, oled_chart_t *chart) {
+    chart->head  = 0;
+    chart->count = 0;
+    if (chart->auto_scale) chart->min = chart->max = 0;
+
+    oled_clear_area(gfx, buf, chart->x, chart->y, chart->width, chart->height);
+}
@@ -0,0 +1,699 @@
+/**
+ * @file oled_core.c
+ * @brief Controller-agnostic framebuffer and graphics core implementation
+ * @version 1.0
+ */
+
+#include "oled_core.h"
+#include <stdlib.h>
+#include <string.h>
+
+// ============================================================================
+// INTERNAL
+// ============================================================================
+
+static inline void mark_column(oled_t *gfx, int x, int page) {
+    if (x < gfx->dirty_start[page]) gfx->dirty_start[page] = (uint8_t)x;
+    if (x > gfx->dirty_end[page])   gfx->dirty_end[page]   = (uint8_t)x;
+}
+
+// Fetch the next character code and advance str. Single bytes are used as
+// they are; the UTF-8 encodings of Latin-1 (U+0080..U+00FF), Greek mu and
+// the ohm sign are folded to the font's one-byte codes, so "°C" and "µV"
+// typed in a UTF-8 source file render as intended.
+static uint8_t next_char(const char **str) {
+    const uint8_t *s = (const uint8_t *)*str;
+    uint8_t ch = *s++;
+
+    if ((ch == 0xC2 || ch == 0xC3) && (s[0] & 0xC0) == 0x80) {
+        ch = (uint8_t)(((ch & 0x03) << 6) | (s[0] & 0x3F));
+        s += 1;
+    } else if (ch == 0xCE && s[0] == 0xA9) {                     // U+03A9 Omega
+        ch = OLED_CHAR_OHM;
+        s += 1;
+    } else if (ch == 0xCE && s[0] == 0xBC) {                     // U+03BC mu
+        ch = OLED_CHAR_MICRO;
+        s += 1;
+    } else if (ch == 0xE2 && s[0] == 0x84 && s[1] == 0xA6) {     // U+2126 ohm sign
+        ch = OLED_CHAR_OHM;
+        s += 2;
+    }
+
+    *str = (const char *)s;
+    return ch;
+}
+
+// Longest fixed-point string: sign, 10 digits, point, leading zero, NUL
+#define FIXED_STR_LEN   14
+
+// Format value / 10^decimals into out, building it backwards from the last
+// digit. Returns the string start inside out.
+static char *format_fixed(char out[FIXED_STR_LEN], int32_t value, uint8_t decimals) {
+    if (decimals > 9) decimals = 9;
+
+    // Magnitude as unsigned, so INT32_MIN does not overflow
+    uint32_t mag = value < 0 ? 0u - (uint32_t)value : (uint32_t)value;
+    char *p = out + FIXED_STR_LEN - 1;
+    *p = '\0';
+
+    int digits = 0;
+    do {
+        *--p = (char)('0' + mag % 10);
+        mag /= 10;
+        if (++digits == decimals) *--p = '.';
+    } while (mag || digits <= decimals);
+
+    if (value < 0) *--p = '-';
+    return p;
+}
+
+// OR a page-format bitmap (w columns, h rows, page rows back to back) into
+// the buffer at any x/y, clipped to the screen. Each source byte lands in
+// at most two destination bytes: shifted down into its page, and the
+// overflow into the page below.
+static void or_bitmap(oled_t *gfx, uint8_t *buf, int x, int y,
+                      const uint8_t *bits, int w, int h) {
+    int c0 = x < 0 ? -x : 0;
+    int c1 = x + w > gfx->width ? gfx->width - x : w;
+    if (c0 >= c1 || h <= 0 || y >= gfx->height || y + h <= 0) return;
+
+    oled_wait_idle(gfx);
+    oled_mark_dirty(gfx, x + c0, y, x + c1 - 1, y + h - 1);
+
+    int pages = gfx->height / 8;
+    int shift = ((y % 8) + 8) % 8;
+    int page  = (y - shift) / 8;
+    int rows  = (h + 7) / 8;
+
+    for (int r = 0; r < rows; r++, page++) {
+        const uint8_t *src = bits + r * w;
+
+        if (page >= 0 && page < pages) {
+            uint8_t *dst = buf + page * gfx->width;
+            for (int c = c0; c < c1; c++) dst[x + c] |= (uint8_t)(src[c] << shift);
+        }
+        if (shift && page + 1 >= 0 && page + 1 < pages) {
+            uint8_t *dst = buf + (page + 1) * gfx->width;
+            for (int c = c0; c < c1; c++) dst[x + c] |= (uint8_t)(src[c] >> (8 - shift));
+        }
+    }
+}
+
+static inline uint8_t apply_rop(uint8_t dst, uint8_t src, uint8_t mask, oled_rop_t rop) {
+    switch (rop) {
+        case OLED_ROP_COPY: return (uint8_t)((dst & ~mask) | (src & mask));
+        case OLED_ROP_AND:  return (uint8_t)(dst & (src | ~mask));
+        case OLED_ROP_XOR:  return (uint8_t)(dst ^ (src & mask));
+        default:            return (uint8_t)(dst | (src & mask));
+    }
+}
+
+// Unchanged bytes shorter than this between two changed runs are sent
+// anyway: a new window costs about as much as these bytes of data
+#define DIFF_MERGE_GAP  8
+
+// Send panel page columns [start, end] and remember them in the shadow.
+// Returns the number of pixel bytes sent.
+static int send_run(oled_t *gfx, int page, uint8_t *data, int start, int end) {
+    gfx->backend->set_window(gfx->ctx, (uint8_t)page, (uint8_t)start, (uint8_t)end);
+    gfx->backend->send_data(gfx->ctx, data + start, end - start + 1);
+    oled_shadow_store(gfx, page, start, data + start, end - start + 1);
+    return end - start + 1;
+}
+
+// Send only the parts of [start, end] that differ from the shadow. data is
+// the word-aligned panel row, words the same row as 32-bit words.
+static int send_changed_runs(oled_t *gfx, int page, uint8_t *data, const uint32_t *words,
+                             int start, int end) {
+    const uint32_t *old_words = gfx->shadow->words + page * (OLED_WIDTH / 4);
+    const uint8_t  *old       = (const uint8_t *)old_words;
+    int run_start = -1, run_end = -1;
+    int sent = 0;
+
+    for (int w = start / 4; w <= end / 4; w++) {
+        if (words[w] == old_words[w]) continue;
+
+        // Narrow the changed word down to its changed bytes
+        int b0 = w * 4, b1 = w * 4 + 3;
+        while (data[b0] == old[b0]) b0++;
+        while (data[b1] == old[b1]) b1--;
+
+        if (run_start >= 0 && b0 - run_end - 1 < DIFF_MERGE_GAP) {
+            run_end = b1;
+        } else {
+            if (run_start >= 0) sent += send_run(gfx, page, data, run_start, run_end);
+            run_start = b0;
+            run_end   = b1;
+        }
+    }
+    if (run_start >= 0) sent += send_run(gfx, page, data, run_start, run_end);
+    return sent;
+}
+
+// Swap rows and columns of an 8x8 pixel block: bit j of in[i] becomes bit i
+// of out[j]. Three rounds of masked swaps on one 64-bit word instead of 64
+// single-pixel moves.
+static void transpose8(const uint8_t *in, uint8_t *out) {
+    uint64_t x = 0, t;
+    for (int i = 0; i < 8; i++) x |= (uint64_t)in[i] << (8 * i);
+
+    t = (x ^ (x >> 7))  & 0x00AA00AA00AA00AAull;  x ^= t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCull;  x ^= t ^ (t << 14);
+    t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ull;  x ^= t ^ (t << 28);
+
+    for (int i = 0; i < 8; i++) out[i] = (uint8_t)(x >> (8 * i));
+}
+
+// Build panel columns [c0, c1] of panel page `page` from a transposed
+// (90/270) canvas into out[c0..c1]. Panel page p, columns 8q..8q+7 are
+// canvas page q, columns 8p..8p+7 with rows and columns swapped.
+static void transpose_span(const oled_t *gfx, const uint8_t *buf, int page,
+                           int c0, int c1, uint8_t *out) {
+    for (int q = c0 / 8; q <= c1 / 8; q++) {
+        transpose8(buf + q * gfx->width + page * 8, out + q * 8);
+    }
+}
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+void oled_bind(oled_t *gfx, const oled_backend_t *backend, void *ctx) {
+    gfx->backend = backend;
+    gfx->ctx     = ctx;
+    gfx->busy    = false;
+
+    gfx->shadow       = NULL;
+    gfx->shadow_valid = false;
+
+    gfx->panel_width  = OLED_WIDTH;
+    gfx->panel_height = OLED_HEIGHT;
+
+    gfx->rotation = OLED_ROTATE_0;
+    gfx->width    = OLED_WIDTH;
+    gfx->height   = OLED_HEIGHT;
+
+    // Panel RAM is undefined after power-up, so the first flush sends everything
+    oled_mark_all_dirty(gfx);
+}
+
+bool oled_set_geometry(oled_t *gfx, uint8_t width, uint8_t height) {
+    // Whole 8x8 blocks keep the transpose and the word-wise diff aligned
+    if (width == 0 || width > OLED_WIDTH || width % 8) return false;
+    if (height == 0 || height > OLED_HEIGHT || height % OLED_PAGE_HEIGHT) return false;
+
+    oled_wait_idle(gfx);
+    gfx->panel_width  = width;
+    gfx->panel_height = height;
+    gfx->width        = oled_is_transposed(gfx) ? height : width;
+    gfx->height       = oled_is_transposed(gfx) ? width  : height;
+
+    oled_shadow_invalidate(gfx);
+    return true;
+}
+
+bool oled_set_rotation(oled_t *gfx, oled_rotation_t rotation) {
+    // 180 mirrors both axes in the controller. 90/270 transpose the canvas
+    // at flush time, then mirror one axis to turn the transpose into a
+    // rotation.
+    bool flip_x = rotation == OLED_ROTATE_90  || rotation == OLED_ROTATE_180;
+    bool flip_y = rotation == OLED_ROTATE_180 || rotation == OLED_ROTATE_270;
+    if ((flip_x || flip_y) && !gfx->backend->set_flip) return false;
+
+    oled_wait_idle(gfx);
+    if (gfx->backend->set_flip) gfx->backend->set_flip(gfx->ctx, flip_x, flip_y);
+
+    gfx->rotation = rotation;
+    gfx->width    = oled_is_transposed(gfx) ? gfx->panel_height : gfx->panel_width;
+    gfx->height   = oled_is_transposed(gfx) ? gfx->panel_width  : gfx->panel_height;
+
+    // Segment remap only applies to data written afterwards, so what the
+    // panel holds no longer matches the shadow either
+    oled_shadow_invalidate(gfx);
+    return true;
+}
+
+// ============================================================================
+// DISPLAY CONTROL
+// ============================================================================
+
+bool oled_set_contrast(oled_t *gfx, uint8_t contrast) {
+    if (!gfx->backend->set_contrast) return false;
+    oled_wait_idle(gfx);
+    gfx->backend->set_contrast(gfx->ctx, contrast);
+    return true;
+}
+
+bool oled_display_on(oled_t *gfx, bool on) {
+    if (!gfx->backend->set_display_on) return false;
+    oled_wait_idle(gfx);
+    gfx->backend->set_display_on(gfx->ctx, on);
+    return true;
+}
+
+bool oled_reinit(oled_t *gfx) {
+    oled_wait_idle(gfx);
+    if (!gfx->backend->init(gfx->ctx)) return false;
+
+    // The init sequence resets mirroring; RAM came back undefined.
+    // set_rotation re-applies the mirroring and invalidates the shadow.
+    if (gfx->rotation != OLED_ROTATE_0) oled_set_rotation(gfx, gfx->rotation);
+    oled_shadow_invalidate(gfx);
+    return true;
+}
+
+// ============================================================================
+// SHADOW FRAME
+// ============================================================================
+
+void oled_set_shadow(oled_t *gfx, oled_shadow_t *shadow) {
+    oled_wait_idle(gfx);
+    gfx->shadow = shadow;
+    oled_shadow_invalidate(gfx);
+}
+
+void oled_shadow_store(oled_t *gfx, int page, int col, const uint8_t *data, int len) {
+    if (!gfx->shadow) return;
+    memcpy((uint8_t *)gfx->shadow->words + page * OLED_WIDTH + col, data, len);
+}
+
+void oled_shadow_invalidate(oled_t *gfx) {
+    gfx->shadow_valid = false;
+    oled_mark_all_dirty(gfx);
+}
+
+// ============================================================================
+// DIRTY TRACKING
+// ============================================================================
+
+void oled_mark_dirty(oled_t *gfx, int x0, int y0, int x1, int y1) {
+    if (x0 > x1) { int t = x0; x0 = x1; x1 = t; }
+    if (y0 > y1) { int t = y0; y0 = y1; y1 = t; }
+    if (x1 < 0 || x0 >= gfx->width || y1 < 0 || y0 >= gfx->height) return;
+
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 >= gfx->width)  x1 = gfx->width - 1;
+    if (y1 >= gfx->height) y1 = gfx->height - 1;
+
+    for (int page = y0 / 8; page <= y1 / 8; page++) {
+        mark_column(gfx, x0, page);
+        mark_column(gfx, x1, page);
+    }
+}
+
+void oled_mark_all_dirty(oled_t *gfx) {
+    oled_clear_dirty(gfx);
+    for (int page = 0; page < gfx->height / 8; page++) {
+        gfx->dirty_start[page] = 0;
+        gfx->dirty_end[page]   = gfx->width - 1;
+    }
+}
+
+void oled_clear_dirty(oled_t *gfx) {
+    memset(gfx->dirty_start, 0xFF, sizeof(gfx->dirty_start));
+    memset(gfx->dirty_end,   0x00, sizeof(gfx->dirty_end));
+}
+
+bool oled_is_dirty(const oled_t *gfx) {
+    for (int page = 0; page < OLED_MAX_PAGES; page++) {
+        if (gfx->dirty_start[page] <= gfx->dirty_end[page]) return true;
+    }
+    return false;
+}
+
+void oled_panel_dirty(const oled_t *gfx, uint8_t start[OLED_NUM_PAGES], uint8_t end[OLED_NUM_PAGES]) {
+    if (!oled_is_transposed(gfx)) {
+        memcpy(start, gfx->dirty_start, OLED_NUM_PAGES);
+        memcpy(end,   gfx->dirty_end,   OLED_NUM_PAGES);
+        return;
+    }
+
+    // Canvas page q, columns s..e lands on panel pages s/8..e/8 as the
+    // 8 panel columns 8q..8q+7
+    memset(start, 0xFF, OLED_NUM_PAGES);
+    memset(end,   0x00, OLED_NUM_PAGES);
+    for (int q = 0; q < gfx->height / 8; q++) {
+        if (gfx->dirty_start[q] > gfx->dirty_end[q]) continue;
+        for (int p = gfx->dirty_start[q] / 8; p <= gfx->dirty_end[q] / 8; p++) {
+            if (q * 8 < start[p])   start[p] = (uint8_t)(q * 8);
+            if (q * 8 + 7 > end[p]) end[p]   = (uint8_t)(q * 8 + 7);
+        }
+    }
+}
+
+const uint8_t *oled_panel_page(const oled_t *gfx, const uint8_t *buf, int page, uint8_t *scratch) {
+    if (!oled_is_transposed(gfx)) return buf + page * gfx->panel_width;
+    transpose_span(gfx, buf, page, 0, gfx->panel_width - 1, scratch);
+    return scratch;
+}
+
+void oled_flush(oled_t *gfx, oled_framebuffer_t *fb) {
+    oled_flush_budget(gfx, fb, 0);
+}
+
+int oled_flush_budget(oled_t *gfx, oled_framebuffer_t *fb, int max_bytes) {
+    return oled_flush_data(gfx, fb->data, max_bytes);
+}
+
+int oled_flush_data(oled_t *gfx, uint8_t *data, int max_bytes) {
+    uint8_t start[OLED_NUM_PAGES], end[OLED_NUM_PAGES];
+    oled_wait_idle(gfx);
+    oled_panel_dirty(gfx, start, end);
+
+    // Transposed pages are built here, word-aligned like the framebuffer;
+    // the word in front provides the spare byte send_data may borrow
+    union {
+        uint32_t words[1 + OLED_WIDTH / 4];
+        uint8_t  bytes[4 + OLED_WIDTH];
+    } stage;
+
+    bool diff   = gfx->shadow && gfx->shadow_valid;
+    bool served = false;
+    int  sent   = 0;
+    int  page;
+
+    // One window per dirty page, covering only its dirty span, or with a
+    // shadow only the runs inside it that changed. The budget is checked
+    // against the whole span; the first dirty page always goes out, even if
+    // the shadow diff leaves nothing of it to send.
+    for (page = 0; page < OLED_NUM_PAGES; page++) {
+        if (start[page] > end[page]) continue;
+        if (max_bytes > 0 && served && sent + end[page] - start[page] + 1 > max_bytes) break;
+        served = true;
+
+        // Rows are panel_width bytes, a multiple of 8, so each stays aligned
+        uint8_t        *row   = data + page * gfx->panel_width;
+        const uint32_t *words = (const uint32_t *)(void *)row;
+        if (oled_is_transposed(gfx)) {
+            transpose_span(gfx, data, page, start[page], end[page], stage.bytes + 4);
+            row   = stage.bytes + 4;
+            words = stage.words + 1;
+        }
+
+        if (diff)
+            sent += send_changed_runs(gfx, page, row, words, start[page], end[page]);
+        else
+            sent += send_run(gfx, page, row, start[page], end[page]);
+    }
+    oled_clear_dirty(gfx);
+
+    if (page < OLED_NUM_PAGES) {
+        // Out of budget: pages from here on stay dirty. A transposed panel
+        // page p, columns s..e, is canvas columns 8p..8p+7 on canvas pages
+        // s/8..e/8.
+        for (; page < OLED_NUM_PAGES; page++) {
+            if (start[page] > end[page]) continue;
+            if (oled_is_transposed(gfx))
+                oled_mark_dirty(gfx, page * 8, start[page], page * 8 + 7, end[page]);
+            else
+                oled_mark_dirty(gfx, start[page], page * 8, end[page], page * 8 + 7);
+        }
+    } else if (gfx->shadow) {
+        // Everything dirty since the shadow was attached or invalidated has
+        // been sent, so it now mirrors the panel
+        gfx->shadow_valid = true;
+    }
+    return sent;
+}
+
+// ============================================================================
+// GRAPHICS
+// ============================================================================
+
+void oled_set_pixel(oled_t *gfx, uint8_t *buf, int x, int y, bool on) {
+    if (x < 0 || x >= gfx->width || y < 0 || y >= gfx->height) return;
+
+    oled_wait_idle(gfx);
+    mark_column(gfx, x, y / 8);
+
+    int idx = (y / 8) * gfx->width + x;
+    if (on)
+        buf[idx] |=  (1 << (y % 8));
+    else
+        buf[idx] &= ~(1 << (y % 8));
+}
+
+void oled_draw_line(oled_t *gfx, uint8_t *buf, int x0, int y0, int x1, int y1, bool on) {
+    // Axis-aligned lines are byte fills, not Bresenham
+    if (y0 == y1 || x0 == x1) {
+        int x = x0 < x1 ? x0 : x1;
+        int y = y0 < y1 ? y0 : y1;
+        oled_fill_rect(gfx, buf, x, y, abs(x1 - x0) + 1, abs(y1 - y0) + 1, on);
+        return;
+    }
+
+    int dx =  abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy;
+
+    while (true) {
+        oled_set_pixel(gfx, buf, x0, y0, on);
+        if (x0 == x1 && y0 == y1) break;
+        int e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x0 += sx; }
+        if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+}
+
+void oled_fill_rect(oled_t *gfx, uint8_t *buf, int x, int y, int w, int h, bool on) {
+    int x0 = x, y0 = y, x1 = x + w - 1, y1 = y + h - 1;
+    if (w <= 0 || h <= 0) return;
+    if (x1 < 0 || x0 >= gfx->width || y1 < 0 || y0 >= gfx->height) return;
+
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 >= gfx->width)  x1 = gfx->width - 1;
+    if (y1 >= gfx->height) y1 = gfx->height - 1;
+
+    oled_wait_idle(gfx);
+    oled_mark_dirty(gfx, x0, y0, x1, y1);
+
+    int ncols = x1 - x0 + 1;
+    int first_page = y0 >> 3;
+    int last_page  = y1 >> 3;
+
+    for (int page = first_page; page <= last_page; page++) {
+        // Rows of this page inside [y0, y1]
+        uint8_t mask = 0xFF;
+        if (page == first_page) mask &= (uint8_t)(0xFF << (y0 & 7));
+        if (page == last_page)  mask &= (uint8_t)(0xFF >> (7 - (y1 & 7)));
+
+        uint8_t *dst = buf + page * gfx->width + x0;
+        if (mask == 0xFF) {
+            memset(dst, on ? 0xFF : 0x00, ncols);
+        } else if (on) {
+            for (int col = 0; col < ncols; col++) dst[col] |= mask;
+        } else {
+            for (int col = 0; col < ncols; col++) dst[col] &= (uint8_t)~mask;
+        }
+    }
+}
+
+void oled_blit(oled_t *gfx, uint8_t *buf, int x, int y, const oled_bitmap_t *bmp, oled_rop_t rop) {
+    int w = bmp->width, h = bmp->height;
+    int c0 = x < 0 ? -x : 0;
+    int c1 = x + w > gfx->width ? gfx->width - x : w;
+    if (c0 >= c1 || h <= 0 || y >= gfx->height || y + h <= 0) return;
+
+    oled_wait_idle(gfx);
+    oled_mark_dirty(gfx, x + c0, y, x + c1 - 1, y + h - 1);
+
+    int pages = gfx->height / 8;
+    int shift = ((y % 8) + 8) % 8;
+    int page  = (y - shift) / 8;
+    int rows  = (h + 7) / 8;
+
+    for (int r = 0; r < rows; r++, page++) {
+        const uint8_t *src = bmp->bits + r * w;
+        const uint8_t *msk = bmp->mask ? bmp->mask + r * w : NULL;
+
+        // Rows past the image height in its last page row are not part of it
+        uint8_t valid = (r == rows - 1 && (h & 7)) ? (uint8_t)(0xFF >> (8 - (h & 7))) : 0xFF;
+
+        bool lo = page >= 0 && page < pages;
+        bool hi = shift && page + 1 >= 0 && page + 1 < pages;
+        uint8_t *dst_lo = lo ? buf + page * gfx->width : NULL;
+        uint8_t *dst_hi = hi ? buf + (page + 1) * gfx->width : NULL;
+
+        for (int c = c0; c < c1; c++) {
+            uint8_t m = msk ? (uint8_t)(msk[c] & valid) : valid;
+            if (lo) dst_lo[x + c] = apply_rop(dst_lo[x + c], (uint8_t)(src[c] << shift),
+                                              (uint8_t)(m << shift), rop);
+            if (hi) dst_hi[x + c] = apply_rop(dst_hi[x + c], (uint8_t)(src[c] >> (8 - shift)),
+                                              (uint8_t)(m >> (8 - shift)), rop);
+        }
+    }
+}
+
+void oled_clear_area(oled_t *gfx, uint8_t *buf, int x, int y, int w, int h) {
+    oled_fill_rect(gfx, buf, x, y, w, h, false);
+}
+
+void oled_draw_hline(oled_t *gfx, uint8_t *buf, int x, int y, int w, bool on) {
+    oled_fill_rect(gfx, buf, x, y, w, 1, on);
+}
+
+void oled_draw_vline(oled_t *gfx, uint8_t *buf, int x, int y, int h, bool on) {
+    oled_fill_rect(gfx, buf, x, y, 1, h, on);
+}
+
+void oled_draw_rect(oled_t *gfx, uint8_t *buf, int x, int y, int w, int h, bool on) {
+    if (w <= 0 || h <= 0) return;
+    oled_draw_hline(gfx, buf, x, y, w, on);
+    oled_draw_hline(gfx, buf, x, y + h - 1, w, on);
+    oled_draw_vline(gfx, buf, x, y, h, on);
+    oled_draw_vline(gfx, buf, x + w - 1, y, h, on);
+}
+
+// ============================================================================
+// TEXT
+// ============================================================================
+
+int oled_draw_glyph(oled_t *gfx, uint8_t *buf, int x, int y, const oled_font_t *font, uint8_t ch) {
+    int w = oled_font_glyph_width(font, ch);
+    or_bitmap(gfx, buf, x, y, oled_font_glyph(font, ch), w, font->height);
+    return w + font->spacing;
+}
+
+int oled_draw_text(oled_t *gfx, uint8_t *buf, int x, int y, const oled_font_t *font, const char *str) {
+    while (*str && x < gfx->width) {
+        x += oled_draw_glyph(gfx, buf, x, y, font, next_char(&str));
+    }
+    return x;
+}
+
+void oled_draw_text_centered(oled_t *gfx, uint8_t *buf, int y, const oled_font_t *font, const char *str) {
+    int x = (gfx->width - oled_text_width(font, str)) / 2;
+    if (x < 0) x = 0;
+    oled_draw_text(gfx, buf, x, y, font, str);
+}
+
+int oled_text_width(const oled_font_t *font, const char *str) {
+    int w = 0;
+    while (*str) w += oled_font_glyph_width(font, next_char(&str)) + font->spacing;
+    // No spacing after the last glyph
+    return w > 0 ? w - font->spacing : 0;
+}
+
+void oled_draw_fixed(oled_t *gfx, uint8_t *buf, int x, int y, const oled_font_t *font,
+                     int32_t value, uint8_t decimals, uint8_t width) {
+    char  str[FIXED_STR_LEN];
+    char *num = format_fixed(str, value, decimals);
+
+    if (width == 0) {
+        oled_draw_text(gfx, buf, x, y, font, num);
+        return;
+    }
+
+    // Digits are tabular in the built-in fonts, so the field is a whole
+    // number of digit cells and the last digit always lands in one place
+    int cell    = oled_font_glyph_width(font, '0') + font->spacing;
+    int field_w = width * cell - font->spacing;
+    int text_w  = oled_text_width(font, num);
+
+    if (text_w > field_w) {
+        // Too wide: mark the field instead of spilling over the neighbours
+        int n = width < FIXED_STR_LEN - 1 ? width : FIXED_STR_LEN - 1;
+        memset(str, '#', n);
+        str[n] = '\0';
+        num    = str;
+        text_w = oled_text_width(font, num);
+    }
+
+    oled_clear_area(gfx, buf, x, y, field_w, font->height);
+    oled_draw_text(gfx, buf, x + field_w - text_w, y, font, num);
+}
+
+void oled_draw_int(oled_t *gfx, uint8_t *buf, int x, int y, const oled_font_t *font,
+                   int32_t value, uint8_t width) {
+    oled_draw_fixed(gfx, buf, x, y, font, value, 0, width);
+}
+
+// ============================================================================
+// LABELS
+// ============================================================================
+
+bool oled_label_init(oled_label_t *label, const oled_font_t *font, const char *str) {
+    bool fits  = true;
+    int  pages = oled_font_pages(font);
+    int  width = oled_text_width(font, str);
+
+    if (pages > OLED_LABEL_MAX_PAGES) { pages = OLED_LABEL_MAX_PAGES; fits = false; }
+    if (width > OLED_LABEL_MAX_WIDTH) { width = OLED_LABEL_MAX_WIDTH; fits = false; }
+
+    label->width = (uint8_t)width;
+    label->pages = (uint8_t)pages;
+    memset(label->bits, 0, sizeof(label->bits));
+
+    // Glyphs are page rows too, so each one is a column-range copy per page
+    int x = 0;
+    while (*str && x < width) {
+        uint8_t ch = next_char(&str);
+        int w = oled_font_glyph_width(font, ch);
+        int n = w < width - x ? w : width - x;
+        const uint8_t *glyph = oled_font_glyph(font, ch);
+
+        for (int p = 0; p < pages; p++) {
+            memcpy(label->bits + p * width + x, glyph + p * w, n);
+        }
+        x += w + font->spacing;
+    }
+    return fits;
+}
+
+void oled_draw_label(oled_t *gfx, uint8_t *buf, int x, int y, const oled_label_t *label) {
+    int w = label->width;
+    int h = label->pages * OLED_PAGE_HEIGHT;
+    if (w == 0 || h == 0) return;
+
+    // Page-aligned and fully on screen: copy the rows straight in
+    if ((y & 7) == 0 && x >= 0 && x + w <= gfx->width && y >= 0 && y + h <= gfx->height) {
+        oled_wait_idle(gfx);
+        oled_mark_dirty(gfx, x, y, x + w - 1, y + h - 1);
+        for (int p = 0; p < label->pages; p++) {
+            memcpy(buf + (y / 8 + p) * gfx->width + x, label->bits + p * w, w);
+        }
+        return;
+    }
+
+    // Anywhere else: clear the cell, then the clipped shifted blit
+    oled_clear_area(gfx, buf, x, y, w, h);
+    or_bitmap(gfx, buf, x, y, label->bits, w, h);
+}
+
+void oled_write_char(oled_t *gfx, uint8_t *buf, int16_t x, int16_t y, uint8_t ch) {
+    if (x < 0 || x > gfx->width - 8 || y < 0 || y > gfx->height - 8) return;
+    oled_draw_glyph(gfx, buf, x, y, &oled_font_8x8, ch);
+}
+
+void oled_write_string(oled_t *gfx, uint8_t *buf, int16_t x, int16_t y, const char *str) {
+    while (*str && x <= gfx->width - 8) {
+        oled_write_char(gfx, buf, x, y, next_char(&str));
+        x += 8;
+    }
+}
+
+void oled_write_centered(oled_t *gfx, uint8_t *buf, int16_t y, const char *str) {
+    int16_t x = (gfx->width - oled_text_width(&oled_font_8x8, str)) / 2;
+    if (x < 0) x = 0;
+    oled_write_string(gfx, buf, x, y, str);
+}
+
+void oled_write_lines(oled_t *gfx, uint8_t *buf, int16_t x, int16_t y,
+                      const char **lines, int line_count, int line_spacing) {
+    for (int i = 0; i < line_count; i++) {
+        if (y > gfx->height - 8) break;  // Don't draw outside screen
+        oled_write_string(gfx, buf, x, y, lines[i]);
+        y += line_spacing;
+    }
+}
+
+void oled_write_fixed(oled_t *gfx, uint8_t *buf, int16_t x, int16_t y,
+                      int32_t value, uint8_t decimals, uint8_t width) {
+    oled_draw_fixed(gfx, buf, x, y, &oled_font_8x8, value, decimals, width);
+}
+
+void oled_write_int(oled_t *gfx, uint8_t *buf, int16_t x, int16_t y, int32_t value, uint8_t width) {
+    oled_draw_fixed(gfx, buf, x, y, &oled_font_8x8, value, 0, width);
+}
@@ -0,0 +1,70 @@
+/**
+ * @file oled_export.c
+ * @brief Framebuffer snapshots as PBM images implementation
+ * @version 1.0
+ */
+
+#include "oled_export.h"
+
+// ============================================================================
+// INTERNAL
+// ============================================================================
+
+// "P4\n<width> <height>\n" with no printf; canvas sides are at most 3 digits
+#define PBM_HEADER_MAX  16
+
+static char *put_uint(char *p, unsigned value) {
+    char digits[3];
+    int  n = 0;
+    do {
+        digits[n++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value && n < 3);
+    while (n) *p++ = digits[--n];
+    return p;
+}
+
+static size_t pbm_header(const oled_t *gfx, char *out) {
+    char *p = out;
+    *p++ = 'P';
+    *p++ = '4';
+    *p++ = '\n';
+    p = put_uint(p, gfx->width);
+    *p++ = ' ';
+    p = put_uint(p, gfx->height);
+    *p++ = '\n';
+    return (size_t)(p - out);
+}
+
+// ============================================================================
+// EXPORT
+// ============================================================================
+
+size_t oled_pbm_size(const oled_t *gfx) {
+    char header[PBM_HEADER_MAX];
+    return pbm_header(gfx, header) + (size_t)gfx->height * (gfx->width / 8);
+}
+
+bool oled_export_pbm(const oled_t *gfx, const uint8_t *buf, oled_write_fn_t write, void *ctx) {
+    char header[PBM_HEADER_MAX];
+    if (!write(ctx, (const uint8_t *)header, pbm_header(gfx, header))) return false;
+
+    // PBM rows are packed MSB first, leftmost pixel in bit 7
+    uint8_t row[OLED_WIDTH / 8];
+    int     row_len = gfx->width / 8;
+
+    for (int y = 0; y < gfx->height; y++) {
+        const uint8_t *src = buf + (y / 8) * gfx->width;
+        int            bit = y & 7;
+
+        for (int i = 0; i < row_len; i++) {
+            uint8_t out = 0;
+            for (int c = 0; c < 8; c++) {
+                out = (uint8_t)((out << 1) | ((src[i * 8 + c] >> bit) & 1));
+            }
+            row[i] = out;
+        }
+        if (!write(ctx, row, (size_t)row_len)) return false;
+    }
+    return true;
+}
@@ -0,0 +1,116 @@
+/**
+ * @file oled_font_12x16.c
+ * @brief Large 12x16 numeric font for readouts
+ * @version 1.0
+ *
+ * Digits and the punctuation needed for values: space % + , - . / 0-9 :
+ * and the degree sign, plus a box for unsupported characters.
+ * Each glyph is the 5x7 shape doubled to 10x14 and sits one row down in a
+ * two-page cell. Digits are 10 columns wide (tabular), punctuation is
+ * trimmed. Each glyph is stored as its top page row followed by its
+ * bottom page row.
+ */
+
+#include "oled_font.h"
+
+static const uint8_t glyphs_12x16[] = {
+    // space
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // %
+    0x1E, 0x1E, 0x1E, 0x1E, 0x80, 0x80, 0x60, 0x60, 0x18, 0x18,
+    0x18, 0x18, 0x06, 0x06, 0x01, 0x01, 0x78, 0x78, 0x78, 0x78,
+    // +
+    0x80, 0x80, 0x80, 0x80, 0xF8, 0xF8, 0x80, 0x80, 0x80, 0x80,
+    0x01, 0x01, 0x01, 0x01, 0x1F, 0x1F, 0x01, 0x01, 0x01, 0x01,
+    // ,
+    0x00, 0x00, 0x00, 0x00,
+    0x66, 0x66, 0x1E, 0x1E,
+    // -
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    // .
+    0x00, 0x00, 0x00, 0x00,
+    0x78, 0x78, 0x78, 0x78,
+    // /
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x60, 0x60, 0x18, 0x18,
+    0x18, 0x18, 0x06, 0x06, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    // 0
+    0xF8, 0xF8, 0x06, 0x06, 0x86, 0x86, 0x66, 0x66, 0xF8, 0xF8,
+    0x1F, 0x1F, 0x66, 0x66, 0x61, 0x61, 0x60, 0x60, 0x1F, 0x1F,
+    // 1
+    0x00, 0x00, 0x18, 0x18, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0x60, 0x7F, 0x7F, 0x60, 0x60, 0x00, 0x00,
+    // 2
+    0x18, 0x18, 0x06, 0x06, 0x06, 0x06, 0x86, 0x86, 0x78, 0x78,
+    0x60, 0x60, 0x78, 0x78, 0x66, 0x66, 0x61, 0x61, 0x60, 0x60,
+    // 3
+    0x06, 0x06, 0x06, 0x06, 0x66, 0x66, 0x9E, 0x9E, 0x06, 0x06,
+    0x18, 0x18, 0x60, 0x60, 0x60, 0x60, 0x61, 0x61, 0x1E, 0x1E,
+    // 4
+    0x80, 0x80, 0x60, 0x60, 0x18, 0x18, 0xFE, 0xFE, 0x00, 0x00,
+    0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x7F, 0x7F, 0x06, 0x06,
+    // 5
+    0x7E, 0x7E, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x86, 0x86,
+    0x18, 0x18, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x1F, 0x1F,
+    // 6
+    0xE0, 0xE0, 0x98, 0x98, 0x86, 0x86, 0x86, 0x86, 0x00, 0x00,
+    0x1F, 0x1F, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x1E, 0x1E,
+    // 7
+    0x06, 0x06, 0x06, 0x06, 0x86, 0x86, 0x66, 0x66, 0x1E, 0x1E,
+    0x00, 0x00, 0x7E, 0x7E, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    // 8
+    0x78, 0x78, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x78, 0x78,
+    0x1E, 0x1E, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x1E, 0x1E,
+    // 9
+    0x78, 0x78, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0xF8, 0xF8,
+    0x00, 0x00, 0x61, 0x61, 0x61, 0x61, 0x19, 0x19, 0x07, 0x07,
+    // :
+    0x78, 0x78, 0x78, 0x78,
+    0x1E, 0x1E, 0x1E, 0x1E,
+    // degree
+    0x78, 0x78, 0x86, 0x86, 0x86, 0x86, 0x78, 0x78,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+    // missing glyph
+    0xFE, 0xFE, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0xFE, 0xFE,
+    0x7F, 0x7F, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x7F, 0x7F,
+};
+
+static const uint16_t offsets_12x16[] = {
+    0, 12, 32, 52, 60, 80, 88, 108, 128, 148, 168, 188, 208, 228, 248, 268, 288, 308, 316, 332
+};
+
+static const uint8_t widths_12x16[] = {
+    6, 10, 10, 4, 10, 4, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 8, 10
+};
+
+// Only the characters a readout needs; anything else shows the
+// missing-glyph box
+static const uint8_t index_12x16[256] = {
+     19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  // 0x00
+     19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  // 0x10
+      0,  19,  19,  19,  19,   1,  19,  19,  19,  19,  19,   2,   3,   4,   5,   6,  // 0x20
+      7,   8,   9,  10,  11,  12,  13,  14,  15,  16,  17,  19,  19,  19,  19,  19,  // 0x30
+     19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  // 0x40
+     19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  // 0x50
+     19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  // 0x60
+     19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  // 0x70
+     19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  // 0x80
+     19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  // 0x90
+     19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  // 0xA0
+     18,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  // 0xB0
+     19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  // 0xC0
+     19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  // 0xD0
+     19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  // 0xE0
+     19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  // 0xF0
+};
+
+const oled_font_t oled_font_12x16 = {
+    .bitmaps = glyphs_12x16,
+    .offsets = offsets_12x16,
+    .widths  = widths_12x16,
+    .index   = index_12x16,
+    .width   = 10,
+    .height  = 16,
+    .spacing = 2,
+};
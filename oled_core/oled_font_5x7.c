@@ -0,0 +1,168 @@
+/**
+ * @file oled_font_5x7.c
+ * @brief Proportional 5x7 font covering printable ASCII
+ * @version 1.0
+ *
+ * Classic 5x7 LCD glyphs with blank side columns trimmed, so narrow
+ * characters (i, l, 1, punctuation) take less room. Digits keep the full
+ * five columns so numbers line up. Glyphs are 7 pixels tall plus one
+ * spare row, so a line fits in one page. After ASCII come the unit
+ * symbols (degree, micro, ohm) and a box for unsupported characters.
+ */
+
+#include "oled_font.h"
+
+static const uint8_t glyphs_5x7[] = {
+    0x00, 0x00, 0x00,  //  
+    0x5F,  // !
+    0x07, 0x00, 0x07,  // "
+    0x14, 0x7F, 0x14, 0x7F, 0x14,  // #
+    0x24, 0x2A, 0x7F, 0x2A, 0x12,  // $
+    0x23, 0x13, 0x08, 0x64, 0x62,  // %
+    0x36, 0x49, 0x55, 0x22, 0x50,  // &
+    0x05, 0x03,  // apostrophe
+    0x1C, 0x22, 0x41,  // (
+    0x41, 0x22, 0x1C,  // )
+    0x14, 0x08, 0x3E, 0x08, 0x14,  // *
+    0x08, 0x08, 0x3E, 0x08, 0x08,  // +
+    0x50, 0x30,  // ,
+    0x08, 0x08, 0x08, 0x08, 0x08,  // -
+    0x60, 0x60,  // .
+    0x20, 0x10, 0x08, 0x04, 0x02,  // /
+    0x3E, 0x51, 0x49, 0x45, 0x3E,  // 0
+    0x00, 0x42, 0x7F, 0x40, 0x00,  // 1
+    0x42, 0x61, 0x51, 0x49, 0x46,  // 2
+    0x21, 0x41, 0x45, 0x4B, 0x31,  // 3
+    0x18, 0x14, 0x12, 0x7F, 0x10,  // 4
+    0x27, 0x45, 0x45, 0x45, 0x39,  // 5
+    0x3C, 0x4A, 0x49, 0x49, 0x30,  // 6
+    0x01, 0x71, 0x09, 0x05, 0x03,  // 7
+    0x36, 0x49, 0x49, 0x49, 0x36,  // 8
+    0x06, 0x49, 0x49, 0x29, 0x1E,  // 9
+    0x36, 0x36,  // :
+    0x56, 0x36,  // ;
+    0x08, 0x14, 0x22, 0x41,  // <
+    0x14, 0x14, 0x14, 0x14, 0x14,  // =
+    0x41, 0x22, 0x14, 0x08,  // >
+    0x02, 0x01, 0x51, 0x09, 0x06,  // ?
+    0x32, 0x49, 0x79, 0x41, 0x3E,  // @
+    0x7E, 0x11, 0x11, 0x11, 0x7E,  // A
+    0x7F, 0x49, 0x49, 0x49, 0x36,  // B
+    0x3E, 0x41, 0x41, 0x41, 0x22,  // C
+    0x7F, 0x41, 0x41, 0x22, 0x1C,  // D
+    0x7F, 0x49, 0x49, 0x49, 0x41,  // E
+    0x7F, 0x09, 0x09, 0x09, 0x01,  // F
+    0x3E, 0x41, 0x49, 0x49, 0x7A,  // G
+    0x7F, 0x08, 0x08, 0x08, 0x7F,  // H
+    0x41, 0x7F, 0x41,  // I
+    0x20, 0x40, 0x41, 0x3F, 0x01,  // J
+    0x7F, 0x08, 0x14, 0x22, 0x41,  // K
+    0x7F, 0x40, 0x40, 0x40, 0x40,  // L
+    0x7F, 0x02, 0x0C, 0x02, 0x7F,  // M
+    0x7F, 0x04, 0x08, 0x10, 0x7F,  // N
+    0x3E, 0x41, 0x41, 0x41, 0x3E,  // O
+    0x7F, 0x09, 0x09, 0x09, 0x06,  // P
+    0x3E, 0x41, 0x51, 0x21, 0x5E,  // Q
+    0x7F, 0x09, 0x19, 0x29, 0x46,  // R
+    0x46, 0x49, 0x49, 0x49, 0x31,  // S
+    0x01, 0x01, 0x7F, 0x01, 0x01,  // T
+    0x3F, 0x40, 0x40, 0x40, 0x3F,  // U
+    0x1F, 0x20, 0x40, 0x20, 0x1F,  // V
+    0x3F, 0x40, 0x38, 0x40, 0x3F,  // W
+    0x63, 0x14, 0x08, 0x14, 0x63,  // X
+    0x07, 0x08, 0x70, 0x08, 0x07,  // Y
+    0x61, 0x51, 0x49, 0x45, 0x43,  // Z
+    0x7F, 0x41, 0x41,  // [
+    0x02, 0x04, 0x08, 0x10, 0x20,  // backslash
+    0x41, 0x41, 0x7F,  // ]
+    0x04, 0x02, 0x01, 0x02, 0x04,  // ^
+    0x40, 0x40, 0x40, 0x40, 0x40,  // _
+    0x01, 0x02, 0x04,  // `
+    0x20, 0x54, 0x54, 0x54, 0x78,  // a
+    0x7F, 0x48, 0x44, 0x44, 0x38,  // b
+    0x38, 0x44, 0x44, 0x44, 0x20,  // c
+    0x38, 0x44, 0x44, 0x48, 0x7F,  // d
+    0x38, 0x54, 0x54, 0x54, 0x18,  // e
+    0x08, 0x7E, 0x09, 0x01, 0x02,  // f
+    0x0C, 0x52, 0x52, 0x52, 0x3E,  // g
+    0x7F, 0x08, 0x04, 0x04, 0x78,  // h
+    0x44, 0x7D, 0x40,  // i
+    0x20, 0x40, 0x44, 0x3D,  // j
+    0x7F, 0x10, 0x28, 0x44,  // k
+    0x41, 0x7F, 0x40,  // l
+    0x7C, 0x04, 0x18, 0x04, 0x78,  // m
+    0x7C, 0x08, 0x04, 0x04, 0x78,  // n
+    0x38, 0x44, 0x44, 0x44, 0x38,  // o
+    0x7C, 0x14, 0x14, 0x14, 0x08,  // p
+    0x08, 0x14, 0x14, 0x18, 0x7C,  // q
+    0x7C, 0x08, 0x04, 0x04, 0x08,  // r
+    0x48, 0x54, 0x54, 0x54, 0x20,  // s
+    0x04, 0x3F, 0x44, 0x40, 0x20,  // t
+    0x3C, 0x40, 0x40, 0x20, 0x7C,  // u
+    0x1C, 0x20, 0x40, 0x20, 0x1C,  // v
+    0x3C, 0x40, 0x30, 0x40, 0x3C,  // w
+    0x44, 0x28, 0x10, 0x28, 0x44,  // x
+    0x0C, 0x50, 0x50, 0x50, 0x3C,  // y
+    0x44, 0x64, 0x54, 0x4C, 0x44,  // z
+    0x08, 0x36, 0x41,  // {
+    0x7F,  // |
+    0x41, 0x36, 0x08,  // }
+    0x10, 0x08, 0x08, 0x10, 0x08,  // ~
+    0x06, 0x09, 0x09, 0x06,  // degree
+    0xFC, 0x40, 0x40, 0x20, 0x7C,  // micro
+    0x4E, 0x71, 0x01, 0x71, 0x4E,  // ohm
+    0x7F, 0x41, 0x41, 0x41, 0x7F,  // missing glyph
+};
+
+static const uint16_t offsets_5x7[] = {
+       0,    3,    4,    7,   12,   17,   22,   27,   29,   32,   35,   40,
+      45,   47,   52,   54,   59,   64,   69,   74,   79,   84,   89,   94,
+      99,  104,  109,  111,  113,  117,  122,  126,  131,  136,  141,  146,
+     151,  156,  161,  166,  171,  176,  179,  184,  189,  194,  199,  204,
+     209,  214,  219,  224,  229,  234,  239,  244,  249,  254,  259,  264,
+     267,  272,  275,  280,  285,  288,  293,  298,  303,  308,  313,  318,
+     323,  328,  331,  335,  339,  342,  347,  352,  357,  362,  367,  372,
+     377,  382,  387,  392,  397,  402,  407,  412,  415,  416,  419,  424,
+     428,  433,  438
+};
+
+static const uint8_t widths_5x7[] = {
+    3, 1, 3, 5, 5, 5, 5, 2, 3, 3, 5, 5, 2, 5, 2, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 2, 2, 4, 5, 4, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 3, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 3, 5, 3, 5, 5,
+    3, 5, 5, 5, 5, 5, 5, 5, 5, 3, 4, 4, 3, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 3, 1, 3, 5, 4,
+    5, 5, 5
+};
+
+// Printable ASCII maps straight to its glyph, then the unit symbols;
+// anything else shows the missing-glyph box
+static const uint8_t index_5x7[256] = {
+     98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  // 0x00
+     98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  // 0x10
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,  // 0x20
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,  30,  31,  // 0x30
+     32,  33,  34,  35,  36,  37,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47,  // 0x40
+     48,  49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,  // 0x50
+     64,  65,  66,  67,  68,  69,  70,  71,  72,  73,  74,  75,  76,  77,  78,  79,  // 0x60
+     80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,  94,  97,  // 0x70
+     98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  // 0x80
+     98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  // 0x90
+     98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  // 0xA0
+     95,  98,  98,  98,  98,  96,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  // 0xB0
+     98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  // 0xC0
+     98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  // 0xD0
+     98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  // 0xE0
+     98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  // 0xF0
+};
+
+const oled_font_t oled_font_5x7 = {
+    .bitmaps = glyphs_5x7,
+    .offsets = offsets_5x7,
+    .widths  = widths_5x7,
+    .index   = index_5x7,
+    .width   = 5,
+    .height  = 8,
+    .spacing = 1,
+};
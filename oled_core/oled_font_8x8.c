@@ -0,0 +1,380 @@
+/**
+ * @file oled_font_8x8.c
+ * @author Mustafa Can Yucel - Claude 4 Sonnet (mustafacan@bridgewiz.com)
+ * @brief Enhanced 8x8 bitmap font shared by the SSD1306 and SH1106 drivers
+ * @version 0.3
+ * @date 2025-08-19
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Enhanced 8x8 font with better readability and essential punctuation support.
+ * Key improvements:
+ * - Better distinction between D and O
+ * - Slashed zero (0) to distinguish from O
+ * - Cleaner, more readable letterforms
+ * - Essential punctuation marks for better readability
+ * - Better spacing and proportions
+ * - Lowercase, full printable ASCII and the unit symbols degree, micro, ohm
+ */
+
+#include "oled_font.h"
+
+/**
+ * @brief Enhanced 8x8 bitmap font with punctuation
+ * 
+ * Vertical bitmaps for printable ASCII and unit symbols. Each character is 8 pixels high and 8 pixels wide.
+ * Characters are defined vertically (each byte is a column) for quick copying to framebuffer.
+ * 
+ * Format: Each character uses 8 bytes, where:
+ * - Byte 0 = leftmost column of pixels
+ * - Byte 7 = rightmost column of pixels  
+ * - Bit 0 = top pixel, Bit 7 = bottom pixel
+ * 
+ * Character order: [SPACE], A-Z, 0-9, punctuation, the rest of ASCII, symbols
+ * Index mapping:
+ * - SPACE = 0
+ * - A-Z = 1-26  
+ * - 0-9 = 27-36
+ * - Punctuation = 37-50
+ * - Remaining printable ASCII (incl. a-z) = 51-94, in code order
+ * - Degree, micro, ohm = 95-97
+ * - Missing-glyph box = 98
+ */
+static const uint8_t glyphs_8x8[] = {
+    // SPACE (index 0)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    
+    // A (index 1) - More pointed top, cleaner lines
+    0x7C, 0x12, 0x11, 0x11, 0x11, 0x12, 0x7C, 0x00,
+    
+    // B (index 2) - Two distinct bumps
+    0x7F, 0x49, 0x49, 0x49, 0x49, 0x49, 0x36, 0x00,
+    
+    // C (index 3) - More curved, open right side
+    0x3E, 0x41, 0x41, 0x41, 0x41, 0x41, 0x22, 0x00,
+    
+    // D (index 4) - Rectangular shape to distinguish from O
+    0x7F, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3E, 0x00,
+    
+    // E (index 5) - Cleaner horizontal lines
+    0x7F, 0x49, 0x49, 0x49, 0x49, 0x49, 0x41, 0x00,
+    
+    // F (index 6) - Like E but no bottom horizontal
+    0x7F, 0x09, 0x09, 0x09, 0x09, 0x09, 0x01, 0x00,
+    
+    // G (index 7) - C with horizontal bar
+    0x3E, 0x41, 0x41, 0x49, 0x49, 0x49, 0x3A, 0x00,
+    
+    // H (index 8) - Two verticals with crossbar
+    0x7F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x7F, 0x00,
+    
+    // I (index 9) - Vertical line with serifs
+    0x41, 0x41, 0x41, 0x7F, 0x41, 0x41, 0x41, 0x00,
+    
+    // J (index 10) - Hook at bottom
+    0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3F, 0x00,
+    
+    // K (index 11) - Diagonal strokes
+    0x7F, 0x08, 0x08, 0x14, 0x22, 0x41, 0x00, 0x00,
+    
+    // L (index 12) - Vertical with bottom horizontal
+    0x7F, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00,
+    
+    // M (index 13) - Two peaks
+    0x7F, 0x02, 0x04, 0x08, 0x04, 0x02, 0x7F, 0x00,
+    
+    // N (index 14) - Diagonal stroke
+    0x7F, 0x02, 0x04, 0x08, 0x10, 0x20, 0x7F, 0x00,
+    
+    // O (index 15) - Perfect oval to distinguish from D and 0
+    0x3E, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3E, 0x00,
+    
+    // P (index 16) - Top bump only
+    0x7F, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00,
+    
+    // Q (index 17) - O with tail
+    0x3E, 0x41, 0x41, 0x51, 0x21, 0x41, 0x5E, 0x00,
+    
+    // R (index 18) - P with leg
+    0x7F, 0x09, 0x09, 0x19, 0x29, 0x49, 0x06, 0x00,
+    
+    // S (index 19) - Curved S shape
+    0x26, 0x49, 0x49, 0x49, 0x49, 0x49, 0x32, 0x00,
+    
+    // T (index 20) - Top bar with center vertical
+    0x01, 0x01, 0x01, 0x7F, 0x01, 0x01, 0x01, 0x00,
+    
+    // U (index 21) - Curved bottom
+    0x3F, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3F, 0x00,
+    
+    // V (index 22) - Angled to point
+    0x0F, 0x10, 0x20, 0x40, 0x20, 0x10, 0x0F, 0x00,
+    
+    // W (index 23) - Double V
+    0x3F, 0x40, 0x20, 0x18, 0x20, 0x40, 0x3F, 0x00,
+    
+    // X (index 24) - Crossing diagonals
+    0x41, 0x22, 0x14, 0x08, 0x14, 0x22, 0x41, 0x00,
+    
+    // Y (index 25) - V shape with vertical
+    0x07, 0x08, 0x10, 0x60, 0x10, 0x08, 0x07, 0x00,
+    
+    // Z (index 26) - Diagonal with horizontals
+    0x41, 0x61, 0x51, 0x49, 0x45, 0x43, 0x41, 0x00,
+    
+    // 0 (index 27) - SLASHED ZERO to distinguish from O
+    0x3E, 0x51, 0x49, 0x45, 0x43, 0x41, 0x3E, 0x00,
+    
+    // 1 (index 28) - Vertical with small serif
+    0x00, 0x42, 0x42, 0x7F, 0x40, 0x40, 0x00, 0x00,
+    
+    // 2 (index 29) - Clear angular shape
+    0x42, 0x61, 0x51, 0x49, 0x45, 0x43, 0x42, 0x00,
+    
+    // 3 (index 30) - Clean two bumps on right
+    0x22, 0x41, 0x49, 0x49, 0x49, 0x49, 0x36, 0x00,
+    
+    // 4 (index 31) - Clear vertical and horizontal
+    0x18, 0x14, 0x12, 0x7F, 0x10, 0x10, 0x10, 0x00,
+    
+    // 5 (index 32) - Top horizontal, bottom curve
+    0x27, 0x45, 0x45, 0x45, 0x45, 0x45, 0x39, 0x00,
+    
+    // 6 (index 33) - Clear bottom loop
+    0x3C, 0x4A, 0x49, 0x49, 0x49, 0x49, 0x30, 0x00,
+    
+    // 7 (index 34) - Top horizontal with diagonal
+    0x01, 0x01, 0x71, 0x09, 0x05, 0x03, 0x01, 0x00,
+    
+    // 8 (index 35) - Two clear loops
+    0x36, 0x49, 0x49, 0x49, 0x49, 0x49, 0x36, 0x00,
+    
+    // 9 (index 36) - Clear top loop
+    0x06, 0x49, 0x49, 0x49, 0x49, 0x29, 0x1E, 0x00,
+
+    // === PUNCTUATION MARKS ===
+    
+    // . (period) (index 37) - Clear dot at bottom
+    0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00,
+    
+    // , (comma) (index 38) - Dot with tail
+    0x00, 0x00, 0x00, 0xA0, 0x60, 0x00, 0x00, 0x00,
+    
+    // % (percent) (index 39) - Two circles with diagonal
+    0x23, 0x13, 0x08, 0x64, 0x62, 0x36, 0x49, 0x00,
+    
+    // - (hyphen/minus) (index 40) - Horizontal line in middle
+    0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00,
+    
+    // : (colon) (index 41) - Two dots vertically
+    0x00, 0x00, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00,
+    
+    // ; (semicolon) (index 42) - Dot and comma
+    0x00, 0x00, 0x56, 0x36, 0x00, 0x00, 0x00, 0x00,
+    
+    // ! (exclamation) (index 43) - Vertical line with dot
+    0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    
+    // ? (question mark) (index 44) - Curved top with dot
+    0x02, 0x01, 0x51, 0x09, 0x06, 0x00, 0x00, 0x00,
+    
+    // / (forward slash) (index 45) - Diagonal line
+    0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x00,
+    
+    // ( (left parenthesis) (index 46) - Left curve
+    0x00, 0x1C, 0x22, 0x41, 0x00, 0x00, 0x00, 0x00,
+    
+    // ) (right parenthesis) (index 47) - Right curve  
+    0x00, 0x41, 0x22, 0x1C, 0x00, 0x00, 0x00, 0x00,
+    
+    // + (plus) (index 48) - Horizontal and vertical cross
+    0x08, 0x08, 0x3E, 0x08, 0x08, 0x00, 0x00, 0x00,
+    
+    // = (equals) (index 49) - Two horizontal lines
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00,
+    
+    // _ (underscore) (index 50) - Bottom line
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    
+    // === MORE PUNCTUATION ===
+    
+    // " (index 51)
+    0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00,
+    
+    // # (index 52)
+    0x00, 0x14, 0x7F, 0x14, 0x7F, 0x14, 0x00, 0x00,
+    
+    // $ (index 53)
+    0x00, 0x24, 0x2A, 0x7F, 0x2A, 0x12, 0x00, 0x00,
+    
+    // & (index 54)
+    0x00, 0x36, 0x49, 0x55, 0x22, 0x50, 0x00, 0x00,
+    
+    // apostrophe (index 55)
+    0x00, 0x00, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00,
+    
+    // * (index 56)
+    0x00, 0x14, 0x08, 0x3E, 0x08, 0x14, 0x00, 0x00,
+    
+    // < (index 57)
+    0x00, 0x08, 0x14, 0x22, 0x41, 0x00, 0x00, 0x00,
+    
+    // > (index 58)
+    0x00, 0x00, 0x41, 0x22, 0x14, 0x08, 0x00, 0x00,
+    
+    // @ (index 59)
+    0x00, 0x32, 0x49, 0x79, 0x41, 0x3E, 0x00, 0x00,
+    
+    // [ (index 60)
+    0x00, 0x00, 0x7F, 0x41, 0x41, 0x00, 0x00, 0x00,
+    
+    // backslash (index 61)
+    0x00, 0x02, 0x04, 0x08, 0x10, 0x20, 0x00, 0x00,
+    
+    // ] (index 62)
+    0x00, 0x00, 0x41, 0x41, 0x7F, 0x00, 0x00, 0x00,
+    
+    // ^ (index 63)
+    0x00, 0x04, 0x02, 0x01, 0x02, 0x04, 0x00, 0x00,
+    
+    // ` (index 64)
+    0x00, 0x00, 0x01, 0x02, 0x04, 0x00, 0x00, 0x00,
+    
+    // === LOWERCASE ===
+    
+    // a (index 65)
+    0x00, 0x20, 0x54, 0x54, 0x54, 0x78, 0x00, 0x00,
+    
+    // b (index 66)
+    0x00, 0x7F, 0x48, 0x44, 0x44, 0x38, 0x00, 0x00,
+    
+    // c (index 67)
+    0x00, 0x38, 0x44, 0x44, 0x44, 0x20, 0x00, 0x00,
+    
+    // d (index 68)
+    0x00, 0x38, 0x44, 0x44, 0x48, 0x7F, 0x00, 0x00,
+    
+    // e (index 69)
+    0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x00,
+    
+    // f (index 70)
+    0x00, 0x08, 0x7E, 0x09, 0x01, 0x02, 0x00, 0x00,
+    
+    // g (index 71)
+    0x00, 0x0C, 0x52, 0x52, 0x52, 0x3E, 0x00, 0x00,
+    
+    // h (index 72)
+    0x00, 0x7F, 0x08, 0x04, 0x04, 0x78, 0x00, 0x00,
+    
+    // i (index 73)
+    0x00, 0x00, 0x44, 0x7D, 0x40, 0x00, 0x00, 0x00,
+    
+    // j (index 74)
+    0x00, 0x20, 0x40, 0x44, 0x3D, 0x00, 0x00, 0x00,
+    
+    // k (index 75)
+    0x00, 0x7F, 0x10, 0x28, 0x44, 0x00, 0x00, 0x00,
+    
+    // l (index 76)
+    0x00, 0x00, 0x41, 0x7F, 0x40, 0x00, 0x00, 0x00,
+    
+    // m (index 77)
+    0x00, 0x7C, 0x04, 0x18, 0x04, 0x78, 0x00, 0x00,
+    
+    // n (index 78)
+    0x00, 0x7C, 0x08, 0x04, 0x04, 0x78, 0x00, 0x00,
+    
+    // o (index 79)
+    0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x00,
+    
+    // p (index 80)
+    0x00, 0x7C, 0x14, 0x14, 0x14, 0x08, 0x00, 0x00,
+    
+    // q (index 81)
+    0x00, 0x08, 0x14, 0x14, 0x18, 0x7C, 0x00, 0x00,
+    
+    // r (index 82)
+    0x00, 0x7C, 0x08, 0x04, 0x04, 0x08, 0x00, 0x00,
+    
+    // s (index 83)
+    0x00, 0x48, 0x54, 0x54, 0x54, 0x20, 0x00, 0x00,
+    
+    // t (index 84)
+    0x00, 0x04, 0x3F, 0x44, 0x40, 0x20, 0x00, 0x00,
+    
+    // u (index 85)
+    0x00, 0x3C, 0x40, 0x40, 0x20, 0x7C, 0x00, 0x00,
+    
+    // v (index 86)
+    0x00, 0x1C, 0x20, 0x40, 0x20, 0x1C, 0x00, 0x00,
+    
+    // w (index 87)
+    0x00, 0x3C, 0x40, 0x30, 0x40, 0x3C, 0x00, 0x00,
+    
+    // x (index 88)
+    0x00, 0x44, 0x28, 0x10, 0x28, 0x44, 0x00, 0x00,
+    
+    // y (index 89)
+    0x00, 0x0C, 0x50, 0x50, 0x50, 0x3C, 0x00, 0x00,
+    
+    // z (index 90)
+    0x00, 0x44, 0x64, 0x54, 0x4C, 0x44, 0x00, 0x00,
+    
+    // === MORE PUNCTUATION ===
+    
+    // { (index 91)
+    0x00, 0x00, 0x08, 0x36, 0x41, 0x00, 0x00, 0x00,
+    
+    // | (index 92)
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    
+    // } (index 93)
+    0x00, 0x00, 0x41, 0x36, 0x08, 0x00, 0x00, 0x00,
+    
+    // ~ (index 94)
+    0x00, 0x10, 0x08, 0x08, 0x10, 0x08, 0x00, 0x00,
+    
+    // === SYMBOLS ===
+    
+    // degree (index 95)
+    0x00, 0x06, 0x09, 0x09, 0x06, 0x00, 0x00, 0x00,
+    
+    // micro (index 96)
+    0x00, 0xFC, 0x40, 0x40, 0x20, 0x7C, 0x00, 0x00,
+    
+    // ohm (index 97)
+    0x4C, 0x52, 0x61, 0x01, 0x61, 0x52, 0x4C, 0x00,
+    
+    // missing glyph (index 98)
+    0x7F, 0x41, 0x41, 0x41, 0x41, 0x41, 0x7F, 0x00,
+};
+
+// Printable ASCII and the unit symbols; anything else shows the missing-glyph box
+static const uint8_t index_8x8[256] = {
+     98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  // 0x00
+     98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  // 0x10
+      0,  43,  51,  52,  53,  39,  54,  55,  46,  47,  56,  48,  38,  40,  37,  45,  // 0x20
+     27,  28,  29,  30,  31,  32,  33,  34,  35,  36,  41,  42,  57,  49,  58,  44,  // 0x30
+     59,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,  // 0x40
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  60,  61,  62,  63,  50,  // 0x50
+     64,  65,  66,  67,  68,  69,  70,  71,  72,  73,  74,  75,  76,  77,  78,  79,  // 0x60
+     80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,  94,  97,  // 0x70
+     98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  // 0x80
+     98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  // 0x90
+     98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  // 0xA0
+     95,  98,  98,  98,  98,  96,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  // 0xB0
+     98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  // 0xC0
+     98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  // 0xD0
+     98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  // 0xE0
+     98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  // 0xF0
+};
+
+const oled_font_t oled_font_8x8 = {
+    .bitmaps = glyphs_8x8,
+    .offsets = NULL,
+    .widths  = NULL,
+    .index   = index_8x8,
+    .width   = 8,
+    .height  = 8,
+    .spacing = 0,
+};
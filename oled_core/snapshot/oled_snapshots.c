@@ -0,0 +1,322 @@
+/**
+ * @file oled_snapshots.c
+ * @brief Render reference scenes through oled_core and export them as PBM
+ * @version 1.0
+ *
+ * Every scene is drawn from a fixed pseudo-random sequence, so its image is
+ * the same on every host. By default the scenes go through the optimized
+ * kernels (byte fills, shifted glyph/bitmap ORs, labels, incremental chart
+ * scrolling). With --reference the same calls go through plain per-pixel
+ * implementations built on oled_set_pixel() instead. The two sets must be
+ * bit-identical; compare them with pbm_compare.
+ *
+ * Usage: oled_snapshots [--reference] <out_dir>
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "oled_core.h"
+#include "oled_chart.h"
+#include "oled_export.h"
+#include "oled_font.h"
+
+// ============================================================================
+// DETERMINISTIC RANDOM
+// ============================================================================
+
+// xorshift32: same sequence on every libc, unlike rand()
+static uint32_t rng_state;
+
+static void rng_seed(uint32_t seed) {
+    rng_state = seed ? seed : 1;
+}
+
+static int rng(int n) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return (int)(rng_state % (uint32_t)n);
+}
+
+// ============================================================================
+// PER-PIXEL REFERENCE
+// ============================================================================
+
+static bool get_pixel(const oled_t *gfx, const uint8_t *buf, int x, int y) {
+    if (x < 0 || x >= gfx->width || y < 0 || y >= gfx->height) return false;
+    return (buf[(y / 8) * gfx->width + x] >> (y & 7)) & 1;
+}
+
+static void ref_fill_rect(oled_t *gfx, uint8_t *buf, int x, int y, int w, int h, bool on) {
+    for (int py = y; py < y + h; py++) {
+        for (int px = x; px < x + w; px++) oled_set_pixel(gfx, buf, px, py, on);
+    }
+}
+
+static void ref_draw_rect(oled_t *gfx, uint8_t *buf, int x, int y, int w, int h, bool on) {
+    for (int py = y; py < y + h; py++) {
+        for (int px = x; px < x + w; px++) {
+            if (px == x || px == x + w - 1 || py == y || py == y + h - 1)
+                oled_set_pixel(gfx, buf, px, py, on);
+        }
+    }
+}
+
+static void ref_draw_line(oled_t *gfx, uint8_t *buf, int x0, int y0, int x1, int y1, bool on) {
+    int dx =  abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy;
+
+    for (;;) {
+        oled_set_pixel(gfx, buf, x0, y0, on);
+        if (x0 == x1 && y0 == y1) break;
+        int e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x0 += sx; }
+        if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+}
+
+static int ref_draw_text(oled_t *gfx, uint8_t *buf, int x, int y, const oled_font_t *font,
+                         const char *str) {
+    for (; *str && x < gfx->width; str++) {
+        uint8_t        ch    = (uint8_t)*str;
+        int            w     = oled_font_glyph_width(font, ch);
+        const uint8_t *glyph = oled_font_glyph(font, ch);
+
+        for (int row = 0; row < font->height; row++) {
+            for (int col = 0; col < w; col++) {
+                if ((glyph[(row / 8) * w + col] >> (row & 7)) & 1)
+                    oled_set_pixel(gfx, buf, x + col, y + row, true);
+            }
+        }
+        x += w + font->spacing;
+    }
+    return x;
+}
+
+static void ref_blit(oled_t *gfx, uint8_t *buf, int x, int y, const oled_bitmap_t *bmp, oled_rop_t rop) {
+    for (int row = 0; row < bmp->height; row++) {
+        for (int col = 0; col < bmp->width; col++) {
+            int  idx = (row / 8) * bmp->width + col;
+            bool src = (bmp->bits[idx] >> (row & 7)) & 1;
+            if (bmp->mask && !((bmp->mask[idx] >> (row & 7)) & 1)) continue;
+
+            bool dst = get_pixel(gfx, buf, x + col, y + row);
+            switch (rop) {
+                case OLED_ROP_COPY: dst = src;        break;
+                case OLED_ROP_OR:   dst = dst || src; break;
+                case OLED_ROP_AND:  dst = dst && src; break;
+                case OLED_ROP_XOR:  dst = dst != src; break;
+            }
+            oled_set_pixel(gfx, buf, x + col, y + row, dst);
+        }
+    }
+}
+
+// ============================================================================
+// SCENES
+// ============================================================================
+
+// Coordinates run a little past every edge so clipping is exercised
+static int rnd_x(const oled_t *gfx) { return rng(gfx->width + 32) - 16; }
+static int rnd_y(const oled_t *gfx) { return rng(gfx->height + 32) - 16; }
+
+static void scene_rects(oled_t *gfx, uint8_t *buf, bool ref) {
+    for (int i = 0; i < 200; i++) {
+        int  x = rnd_x(gfx), y = rnd_y(gfx), w = rng(48), h = rng(48);
+        bool on = rng(3) != 0;
+
+        switch (rng(5)) {
+            case 0:
+                ref ? ref_fill_rect(gfx, buf, x, y, w, h, on) : oled_fill_rect(gfx, buf, x, y, w, h, on);
+                break;
+            case 1:
+                ref ? ref_draw_rect(gfx, buf, x, y, w, h, on) : oled_draw_rect(gfx, buf, x, y, w, h, on);
+                break;
+            case 2:
+                ref ? ref_fill_rect(gfx, buf, x, y, w, h, false) : oled_clear_area(gfx, buf, x, y, w, h);
+                break;
+            case 3:
+                ref ? ref_fill_rect(gfx, buf, x, y, w, 1, on) : oled_draw_hline(gfx, buf, x, y, w, on);
+                break;
+            default:
+                ref ? ref_fill_rect(gfx, buf, x, y, 1, h, on) : oled_draw_vline(gfx, buf, x, y, h, on);
+                break;
+        }
+    }
+}
+
+static void scene_rects_rotated(oled_t *gfx, uint8_t *buf, bool ref) {
+    oled_set_rotation(gfx, OLED_ROTATE_90);
+    scene_rects(gfx, buf, ref);
+}
+
+static void scene_lines(oled_t *gfx, uint8_t *buf, bool ref) {
+    for (int i = 0; i < 100; i++) {
+        int x0 = rnd_x(gfx), y0 = rnd_y(gfx), x1 = rnd_x(gfx), y1 = rnd_y(gfx);
+        if (i % 4 == 0) y1 = y0;    // Axis-aligned lines take the fill path
+        if (i % 4 == 1) x1 = x0;
+        ref ? ref_draw_line(gfx, buf, x0, y0, x1, y1, true) : oled_draw_line(gfx, buf, x0, y0, x1, y1, true);
+    }
+}
+
+static void draw_font_lines(oled_t *gfx, uint8_t *buf, bool ref, const oled_font_t *font) {
+    static const char *text[] = {
+        "The quick brown fox", "JUMPS over 13 lazy", "dogs! {[(<@#$%&>)]}", "0123456789 +-*/=?",
+    };
+    for (int i = 0; i < 12; i++) {
+        int x = rng(gfx->width + 16) - 16, y = rnd_y(gfx);
+        const char *s = text[i % 4];
+        ref ? ref_draw_text(gfx, buf, x, y, font, s) : oled_draw_text(gfx, buf, x, y, font, s);
+    }
+}
+
+static void scene_text_5x7(oled_t *gfx, uint8_t *buf, bool ref) {
+    draw_font_lines(gfx, buf, ref, &oled_font_5x7);
+}
+
+static void scene_text_8x8(oled_t *gfx, uint8_t *buf, bool ref) {
+    draw_font_lines(gfx, buf, ref, &oled_font_8x8);
+}
+
+static void scene_text_12x16(oled_t *gfx, uint8_t *buf, bool ref) {
+    static const char *text[] = { "12.34", "-0.5%", "23:59", "+1,000" };
+    for (int i = 0; i < 8; i++) {
+        int x = rng(gfx->width + 16) - 16, y = rnd_y(gfx);
+        const char *s = text[i % 4];
+        ref ? ref_draw_text(gfx, buf, x, y, &oled_font_12x16, s)
+            : oled_draw_text(gfx, buf, x, y, &oled_font_12x16, s);
+    }
+}
+
+static void scene_labels(oled_t *gfx, uint8_t *buf, bool ref) {
+    static const char *text[] = { "BATT", "Temp", "12.5V", "OK" };
+    const oled_font_t *fonts[] = { &oled_font_5x7, &oled_font_8x8, &oled_font_12x16 };
+
+    // Background to show that labels are opaque
+    for (int i = 0; i < 64; i++) oled_set_pixel(gfx, buf, rng(gfx->width), rng(gfx->height), true);
+
+    for (int i = 0; i < 10; i++) {
+        const oled_font_t *font = fonts[i % 3];
+        const char        *s    = font == &oled_font_12x16 ? "12.5" : text[i % 4];
+        int x = rng(gfx->width + 16) - 16, y = rng(OLED_NUM_PAGES) * OLED_PAGE_HEIGHT;
+
+        oled_label_t label;
+        oled_label_init(&label, font, s);
+        if (ref) {
+            ref_fill_rect(gfx, buf, x, y, label.width, label.pages * OLED_PAGE_HEIGHT, false);
+            ref_draw_text(gfx, buf, x, y, font, s);
+        } else {
+            oled_draw_label(gfx, buf, x, y, &label);
+        }
+    }
+}
+
+static void scene_blit(oled_t *gfx, uint8_t *buf, bool ref) {
+    uint8_t bits[3 * 24], mask[3 * 24];
+
+    for (int i = 0; i < 80; i++) {
+        int w = 1 + rng(24), h = 1 + rng(24);
+        for (int b = 0; b < 3 * 24; b++) {
+            bits[b] = (uint8_t)rng(256);
+            mask[b] = (uint8_t)(rng(256) | rng(256));
+        }
+        oled_bitmap_t bmp = { bits, rng(2) ? mask : NULL, (uint8_t)w, (uint8_t)h };
+        oled_rop_t    rop = (oled_rop_t)rng(4);
+        int x = rnd_x(gfx), y = rnd_y(gfx);
+
+        ref ? ref_blit(gfx, buf, x, y, &bmp, rop) : oled_blit(gfx, buf, x, y, &bmp, rop);
+    }
+}
+
+static void scene_chart(oled_t *gfx, uint8_t *buf, bool ref) {
+    static oled_chart_t chart;
+    oled_chart_init(gfx, &chart, 4, 12, 120, 48, 0, 0);
+
+    // Incremental scrolling must end up where a full redraw does
+    for (int i = 0; i < 300; i++) {
+        int32_t sample = (i % 80 < 40 ? i % 40 : 40 - i % 40) * 25 + rng(60);
+        oled_chart_push(gfx, buf, &chart, sample);
+    }
+    if (ref) {
+        ref_fill_rect(gfx, buf, 0, 0, gfx->width, gfx->height, false);
+        oled_chart_redraw(gfx, buf, &chart);
+    }
+}
+
+typedef struct {
+    const char *name;
+    void      (*draw)(oled_t *gfx, uint8_t *buf, bool ref);
+} scene_t;
+
+static const scene_t scenes[] = {
+    { "rects",         scene_rects },
+    { "rects_rot90",   scene_rects_rotated },
+    { "lines",         scene_lines },
+    { "text_5x7",      scene_text_5x7 },
+    { "text_8x8",      scene_text_8x8 },
+    { "text_12x16",    scene_text_12x16 },
+    { "labels",        scene_labels },
+    { "blit",          scene_blit },
+    { "chart",         scene_chart },
+};
+
+// ============================================================================
+// OUTPUT
+// ============================================================================
+
+static bool file_write(void *ctx, const uint8_t *data, size_t len) {
+    return fwrite(data, 1, len, (FILE *)ctx) == len;
+}
+
+// Drawing only; the core never calls these without a flush
+static void null_window(void *ctx, uint8_t page, uint8_t c0, uint8_t c1) {
+    (void)ctx; (void)page; (void)c0; (void)c1;
+}
+static void null_send(void *ctx, uint8_t *data, int len) {
+    (void)ctx; (void)data; (void)len;
+}
+static void null_flip(void *ctx, bool flip_x, bool flip_y) {
+    (void)ctx; (void)flip_x; (void)flip_y;
+}
+static const oled_backend_t null_backend = {
+    .set_window = null_window,
+    .send_data  = null_send,
+    .set_flip   = null_flip,
+};
+
+int main(int argc, char **argv) {
+    bool        ref = argc > 2 && strcmp(argv[1], "--reference") == 0;
+    const char *dir = argv[argc - 1];
+
+    if (argc < 2 || (argc > 2 && !ref)) {
+        fprintf(stderr, "usage: %s [--reference] <out_dir>\n", argv[0]);
+        return 2;
+    }
+
+    for (size_t i = 0; i < sizeof(scenes) / sizeof(scenes[0]); i++) {
+        static oled_t             gfx;
+        static oled_framebuffer_t fb;
+        char path[512];
+
+        oled_bind(&gfx, &null_backend, NULL);
+        OLED_CLEAR_BUFFER(fb.data);
+        rng_seed(0x5EED0000u + (uint32_t)i);
+        scenes[i].draw(&gfx, fb.data, ref);
+
+        snprintf(path, sizeof(path), "%s/%s.pbm", dir, scenes[i].name);
+        FILE *f = fopen(path, "wb");
+        if (!f) {
+            perror(path);
+            return 2;
+        }
+        bool ok = oled_export_pbm(&gfx, fb.data, file_write, f);
+        if (fclose(f) != 0 || !ok) {
+            fprintf(stderr, "%s: write failed\n", path);
+            return 2;
+        }
+        printf("%s\n", path);
+    }
+    return 0;
+}
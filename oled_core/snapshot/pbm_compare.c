@@ -0,0 +1,220 @@
+/**
+ * @file pbm_compare.c
+ * @brief Compare PBM snapshots against golden images
+ * @version 1.0
+ *
+ * Compares two PBM files, or every *.pbm in a golden directory against the
+ * file of the same name in an actual directory. Reports the number of
+ * differing pixels and their bounding box, and with -d writes an image per
+ * mismatch with the differing pixels set. Reads P4 (binary, as written by
+ * oled_export_pbm) and P1 (ASCII, handy for hand-made goldens).
+ *
+ * Usage: pbm_compare [-d diff_dir] <actual> <golden>
+ * Exit status: 0 all identical, 1 differences, 2 error.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+// Canvases are at most 128 pixels on either side
+#define PBM_MAX_SIDE    256
+
+typedef struct {
+    int     width;
+    int     height;
+    uint8_t pixels[PBM_MAX_SIDE * PBM_MAX_SIDE];   // One byte per pixel, 1 = black
+} pbm_t;
+
+// ============================================================================
+// PBM FILES
+// ============================================================================
+
+// Next header token, skipping whitespace and # comments
+static int read_header_int(FILE *f) {
+    int c;
+    for (;;) {
+        c = fgetc(f);
+        if (c == '#') {
+            while (c != '\n' && c != EOF) c = fgetc(f);
+        } else if (c != ' ' && c != '\t' && c != '\r' && c != '\n') {
+            break;
+        }
+    }
+    if (c < '0' || c > '9') return -1;
+
+    int value = 0;
+    while (c >= '0' && c <= '9') {
+        value = value * 10 + (c - '0');
+        if (value > PBM_MAX_SIDE) return -1;
+        c = fgetc(f);
+    }
+    // One whitespace byte ends the token; for P4 it also ends the header
+    return value;
+}
+
+static bool pbm_read(const char *path, pbm_t *img) {
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return false;
+    }
+
+    bool ok = false;
+    char magic[2];
+    if (fread(magic, 1, 2, f) == 2 && magic[0] == 'P' && (magic[1] == '1' || magic[1] == '4')) {
+        img->width  = read_header_int(f);
+        img->height = read_header_int(f);
+        ok = img->width > 0 && img->height > 0;
+
+        for (int y = 0; ok && y < img->height; y++) {
+            uint8_t *row = img->pixels + y * img->width;
+            if (magic[1] == '4') {
+                for (int x = 0; ok && x < img->width; x += 8) {
+                    int byte = fgetc(f);
+                    if (byte == EOF) ok = false;
+                    for (int b = 0; ok && b < 8 && x + b < img->width; b++) {
+                        row[x + b] = (byte >> (7 - b)) & 1;
+                    }
+                }
+            } else {
+                for (int x = 0; ok && x < img->width; x++) {
+                    int c;
+                    do c = fgetc(f); while (c == ' ' || c == '\t' || c == '\r' || c == '\n');
+                    if (c != '0' && c != '1') ok = false;
+                    row[x] = (uint8_t)(c == '1');
+                }
+            }
+        }
+    }
+    fclose(f);
+
+    if (!ok) fprintf(stderr, "%s: not a readable PBM image\n", path);
+    return ok;
+}
+
+static bool pbm_write(const char *path, const pbm_t *img) {
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        perror(path);
+        return false;
+    }
+    fprintf(f, "P4\n%d %d\n", img->width, img->height);
+    for (int y = 0; y < img->height; y++) {
+        for (int x = 0; x < img->width; x += 8) {
+            int byte = 0;
+            for (int b = 0; b < 8; b++) {
+                int px = x + b < img->width ? img->pixels[y * img->width + x + b] : 0;
+                byte |= px << (7 - b);
+            }
+            fputc(byte, f);
+        }
+    }
+    return fclose(f) == 0;
+}
+
+// ============================================================================
+// COMPARISON
+// ============================================================================
+
+// Returns 0 identical, 1 different, 2 error
+static int compare(const char *actual_path, const char *golden_path, const char *diff_path) {
+    static pbm_t actual, golden, diff;
+
+    if (!pbm_read(actual_path, &actual) || !pbm_read(golden_path, &golden)) return 2;
+
+    if (actual.width != golden.width || actual.height != golden.height) {
+        printf("DIFF %s: size %dx%d, golden %dx%d\n", actual_path,
+               actual.width, actual.height, golden.width, golden.height);
+        return 1;
+    }
+
+    int count = 0, x0 = golden.width, y0 = golden.height, x1 = -1, y1 = -1;
+    diff.width  = golden.width;
+    diff.height = golden.height;
+    for (int y = 0; y < golden.height; y++) {
+        for (int x = 0; x < golden.width; x++) {
+            int i = y * golden.width + x;
+            diff.pixels[i] = actual.pixels[i] != golden.pixels[i];
+            if (!diff.pixels[i]) continue;
+
+            count++;
+            if (x < x0) x0 = x;
+            if (x > x1) x1 = x;
+            if (y < y0) y0 = y;
+            if (y > y1) y1 = y;
+        }
+    }
+
+    if (count == 0) {
+        printf("ok   %s\n", actual_path);
+        return 0;
+    }
+
+    printf("DIFF %s: %d pixels in (%d,%d)-(%d,%d)\n", actual_path, count, x0, y0, x1, y1);
+    if (diff_path && !pbm_write(diff_path, &diff)) return 2;
+    return 1;
+}
+
+static bool is_dir(const char *path) {
+    struct stat st;
+    return stat(path, &st) == 0 && S_ISDIR(st.st_mode);
+}
+
+static bool has_pbm_suffix(const char *name) {
+    size_t len = strlen(name);
+    return len > 4 && strcmp(name + len - 4, ".pbm") == 0;
+}
+
+int main(int argc, char **argv) {
+    const char *diff_dir = NULL;
+    int arg = 1;
+
+    if (argc > 2 && strcmp(argv[1], "-d") == 0) {
+        diff_dir = argv[2];
+        arg = 3;
+    }
+    if (argc - arg != 2) {
+        fprintf(stderr, "usage: %s [-d diff_dir] <actual> <golden>\n", argv[0]);
+        return 2;
+    }
+    const char *actual = argv[arg], *golden = argv[arg + 1];
+    char diff_path[512];
+
+    if (!is_dir(golden)) {
+        if (diff_dir) snprintf(diff_path, sizeof(diff_path), "%s/diff.pbm", diff_dir);
+        return compare(actual, golden, diff_dir ? diff_path : NULL);
+    }
+
+    DIR *dir = opendir(golden);
+    if (!dir) {
+        perror(golden);
+        return 2;
+    }
+
+    int status = 0, files = 0;
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        if (!has_pbm_suffix(entry->d_name)) continue;
+
+        char actual_path[512], golden_path[512];
+        snprintf(actual_path, sizeof(actual_path), "%s/%s", actual, entry->d_name);
+        snprintf(golden_path, sizeof(golden_path), "%s/%s", golden, entry->d_name);
+        if (diff_dir) snprintf(diff_path, sizeof(diff_path), "%s/%s", diff_dir, entry->d_name);
+
+        int result = compare(actual_path, golden_path, diff_dir ? diff_path : NULL);
+        if (result > status) status = result;
+        files++;
+    }
+    closedir(dir);
+
+    if (files == 0) {
+        fprintf(stderr, "%s: no .pbm files\n", golden);
+        return 2;
+    }
+    return status;
+}
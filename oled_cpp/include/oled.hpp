@@ -0,0 +1,225 @@
+/**
+ * @file oled.hpp
+ * @brief Compile-time panel geometry for oled_core (optional C++ layer)
+ * @version 1.0
+ *
+ * Header-only C++17 wrapper around the C core, templated on the controller,
+ * the panel size and the rotation. Buffer sizes, page counts and the
+ * canvas size are constants, so a 72x40 panel takes a 360-byte buffer
+ * instead of 1024, and clear/fill/set_pixel compile to fixed-size stores
+ * with the bounds check folded into two unsigned compares. Everything
+ * else (lines, text, blits, flushing) is the C core, which already clips
+ * against the canvas size held in oled_t.
+ *
+ * The controller is a small traits struct (oled_ssd1306.hpp,
+ * oled_sh1106.hpp) that names the driver types and rejects sizes the
+ * controller cannot drive at compile time.
+ *
+ * Usage:
+ *   #include "oled_ssd1306.hpp"
+ *
+ *   static oled::ssd1306_72x40 display;
+ *   display.init(ssd1306_create_config(i2c0, 16, 17));
+ *
+ *   display.clear();
+ *   display.text(0, 0, &oled_font_5x7, "72x40");
+ *   display.flush();
+ */
+
+#ifndef OLED_HPP
+#define OLED_HPP
+
+#if __cplusplus < 201703L
+#error "oled.hpp needs C++17"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "oled_core.h"
+
+namespace oled {
+
+// ============================================================================
+// GEOMETRY
+// ============================================================================
+
+// Panel geometry before rotation. Sides must be whole 8x8 blocks, which
+// the transposing flush and the word-wise shadow diff rely on.
+template <uint8_t Width, uint8_t Height>
+struct geometry {
+    static_assert(Width > 0 && Width <= OLED_WIDTH && Width % 8 == 0,
+                  "panel width must be a multiple of 8, at most OLED_WIDTH");
+    static_assert(Height > 0 && Height <= OLED_HEIGHT && Height % OLED_PAGE_HEIGHT == 0,
+                  "panel height must be a multiple of 8, at most OLED_HEIGHT");
+
+    static constexpr uint8_t     width   = Width;
+    static constexpr uint8_t     height  = Height;
+    static constexpr uint8_t     pages   = Height / OLED_PAGE_HEIGHT;
+    static constexpr std::size_t buf_len = std::size_t(Width) * pages;
+};
+
+// ============================================================================
+// FRAMEBUFFER
+// ============================================================================
+
+// oled_framebuffer_t sized to the panel: the spare control byte in front
+// and word-aligned pixel data, as oled_flush_data() expects
+template <std::size_t Len>
+struct framebuffer {
+    static_assert(Len % 4 == 0, "framebuffer length must be whole words");
+
+    uint8_t reserved[3];
+    uint8_t control;
+    union {
+        uint8_t  data[Len];
+        uint32_t words[Len / 4];
+    };
+};
+
+// ============================================================================
+// DISPLAY
+// ============================================================================
+
+// One panel with its own framebuffer. Controller is a traits struct with
+// device_type, config_type, supports(w, h), init(dev, config, w, h) and
+// gfx(dev). Rotation is fixed here too, so the canvas size is a constant.
+template <typename Controller, uint8_t Width, uint8_t Height,
+          oled_rotation_t Rotation = OLED_ROTATE_0>
+class display {
+public:
+    using controller  = Controller;
+    using panel       = geometry<Width, Height>;
+    using device_type = typename Controller::device_type;
+    using config_type = typename Controller::config_type;
+
+    static_assert(Controller::supports(Width, Height), "controller cannot drive this panel size");
+
+    // The driver's core points back at dev_ once initialized, so a copy
+    // would drive this display's device (or a dead one): keep it in place
+    display() = default;
+    display(const display &) = delete;
+    display &operator=(const display &) = delete;
+    display(display &&) = delete;
+    display &operator=(display &&) = delete;
+
+    // Canvas as drawn, after rotation
+    static constexpr bool        transposed = Rotation == OLED_ROTATE_90 ||
+                                              Rotation == OLED_ROTATE_270;
+    static constexpr uint8_t     width      = transposed ? Height : Width;
+    static constexpr uint8_t     height     = transposed ? Width  : Height;
+    static constexpr uint8_t     pages      = height / OLED_PAGE_HEIGHT;
+    static constexpr std::size_t buf_len    = panel::buf_len;
+
+    // Bring the panel up at this size and rotation. The buffer starts clear
+    // and all dirty, so the first flush blanks the panel RAM.
+    bool init(config_type config) {
+        if (!Controller::init(dev_, config, Width, Height)) return false;
+        if (Rotation != OLED_ROTATE_0 && !oled_set_rotation(&gfx(), Rotation)) return false;
+        std::memset(fb_.data, 0x00, buf_len);
+        return true;
+    }
+
+    device_type       &device()       { return dev_; }
+    oled_t            &gfx()          { return Controller::gfx(dev_); }
+    const oled_t      &gfx() const    { return Controller::gfx(dev_); }
+    uint8_t           *buffer()       { return fb_.data; }
+    const uint8_t     *buffer() const { return fb_.data; }
+
+    static constexpr bool contains(int x, int y) {
+        return unsigned(x) < width && unsigned(y) < height;
+    }
+
+    // ------------------------------------------------------------------------
+    // Whole buffer and single pixels, sized at compile time
+    // ------------------------------------------------------------------------
+
+    void clear() { fill_bytes(0x00); }
+    void fill()  { fill_bytes(0xFF); }
+
+    void set_pixel(int x, int y, bool on = true) {
+        if (!contains(x, y)) return;
+
+        oled_wait_idle(&gfx());
+        mark_column(x, y / OLED_PAGE_HEIGHT);
+
+        uint8_t &byte = fb_.data[(y / OLED_PAGE_HEIGHT) * width + x];
+        uint8_t  bit  = uint8_t(1u << (y % OLED_PAGE_HEIGHT));
+        byte = on ? uint8_t(byte | bit) : uint8_t(byte & ~bit);
+    }
+
+    bool get_pixel(int x, int y) const {
+        if (!contains(x, y)) return false;
+        return (fb_.data[(y / OLED_PAGE_HEIGHT) * width + x] >> (y % OLED_PAGE_HEIGHT)) & 1;
+    }
+
+    // ------------------------------------------------------------------------
+    // Drawing, through the C core
+    // ------------------------------------------------------------------------
+
+    void line(int x0, int y0, int x1, int y1, bool on = true) {
+        oled_draw_line(&gfx(), fb_.data, x0, y0, x1, y1, on);
+    }
+    void hline(int x, int y, int w, bool on = true) { oled_draw_hline(&gfx(), fb_.data, x, y, w, on); }
+    void vline(int x, int y, int h, bool on = true) { oled_draw_vline(&gfx(), fb_.data, x, y, h, on); }
+    void rect(int x, int y, int w, int h, bool on = true) {
+        oled_draw_rect(&gfx(), fb_.data, x, y, w, h, on);
+    }
+    void fill_rect(int x, int y, int w, int h, bool on = true) {
+        oled_fill_rect(&gfx(), fb_.data, x, y, w, h, on);
+    }
+    void clear_area(int x, int y, int w, int h) { oled_clear_area(&gfx(), fb_.data, x, y, w, h); }
+
+    void blit(int x, int y, const oled_bitmap_t &bmp, oled_rop_t rop = OLED_ROP_OR) {
+        oled_blit(&gfx(), fb_.data, x, y, &bmp, rop);
+    }
+
+    int text(int x, int y, const oled_font_t *font, const char *str) {
+        return oled_draw_text(&gfx(), fb_.data, x, y, font, str);
+    }
+    void text_centered(int y, const oled_font_t *font, const char *str) {
+        oled_draw_text_centered(&gfx(), fb_.data, y, font, str);
+    }
+    void fixed(int x, int y, const oled_font_t *font, int32_t value, uint8_t decimals,
+               uint8_t field = 0) {
+        oled_draw_fixed(&gfx(), fb_.data, x, y, font, value, decimals, field);
+    }
+    void integer(int x, int y, const oled_font_t *font, int32_t value, uint8_t field = 0) {
+        oled_draw_int(&gfx(), fb_.data, x, y, font, value, field);
+    }
+    void label(int x, int y, const oled_label_t &lbl) { oled_draw_label(&gfx(), fb_.data, x, y, &lbl); }
+
+    // ------------------------------------------------------------------------
+    // Panel
+    // ------------------------------------------------------------------------
+
+    // Send dirty regions; max_bytes as in oled_flush_budget() (0: no limit)
+    int  flush(int max_bytes = 0) { return oled_flush_data(&gfx(), fb_.data, max_bytes); }
+    bool dirty() const            { return oled_is_dirty(&gfx()); }
+    void mark_all_dirty()         { oled_mark_all_dirty(&gfx()); }
+
+    void set_shadow(oled_shadow_t *shadow)  { oled_set_shadow(&gfx(), shadow); }
+    bool set_contrast(uint8_t contrast)     { return oled_set_contrast(&gfx(), contrast); }
+    bool display_on(bool on)                { return oled_display_on(&gfx(), on); }
+
+private:
+    void fill_bytes(uint8_t value) {
+        oled_wait_idle(&gfx());
+        std::memset(fb_.data, value, buf_len);
+        oled_mark_all_dirty(&gfx());
+    }
+
+    // Same bookkeeping as the core's own: widen the page's dirty span to x
+    void mark_column(int x, int page) {
+        oled_t &g = gfx();
+        if (x < g.dirty_start[page]) g.dirty_start[page] = uint8_t(x);
+        if (x > g.dirty_end[page])   g.dirty_end[page]   = uint8_t(x);
+    }
+
+    device_type          dev_{};
+    framebuffer<buf_len> fb_{};
+};
+
+} // namespace oled
+
+#endif // OLED_HPP
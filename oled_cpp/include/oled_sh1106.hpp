@@ -0,0 +1,42 @@
+/**
+ * @file oled_sh1106.hpp
+ * @brief SH1106 controller for the oled.hpp display template
+ * @version 1.0
+ *
+ * The sh1106 driver only knows the common 128x64 module (132-column RAM,
+ * visible columns 2-129), so that is the only size accepted. Link the
+ * sh1106 library alongside oled_cpp.
+ */
+
+#ifndef OLED_SH1106_HPP
+#define OLED_SH1106_HPP
+
+#include "oled.hpp"
+#include "sh1106_i2c.h"
+
+namespace oled {
+
+struct sh1106 {
+    using device_type = sh1106_t;
+    using config_type = sh1106_config_t;
+
+    static constexpr bool supports(uint8_t width, uint8_t height) {
+        return width == SH1106_WIDTH && height == SH1106_HEIGHT;
+    }
+
+    static bool init(sh1106_t &dev, sh1106_config_t config, uint8_t, uint8_t) {
+        return sh1106_init(&dev, &config);
+    }
+
+    static oled_t       &gfx(sh1106_t &dev)       { return dev.gfx; }
+    static const oled_t &gfx(const sh1106_t &dev) { return dev.gfx; }
+};
+
+template <oled_rotation_t Rotation = OLED_ROTATE_0>
+using sh1106_display = display<sh1106, SH1106_WIDTH, SH1106_HEIGHT, Rotation>;
+
+using sh1106_128x64 = sh1106_display<>;
+
+} // namespace oled
+
+#endif // OLED_SH1106_HPP
@@ -0,0 +1,46 @@
+/**
+ * @file oled_ssd1306.hpp
+ * @brief SSD1306 controller for the oled.hpp display template
+ * @version 1.0
+ *
+ * The SSD1306 has 128x64 of RAM and drives panels up to that size, e.g.
+ * 128x64, 128x32, 72x40 and 64x48; narrower panels show the middle of the
+ * RAM. Link the ssd1306 library alongside oled_cpp.
+ */
+
+#ifndef OLED_SSD1306_HPP
+#define OLED_SSD1306_HPP
+
+#include "oled.hpp"
+#include "ssd1306.h"
+
+namespace oled {
+
+struct ssd1306 {
+    using device_type = ssd1306_t;
+    using config_type = ssd1306_config_t;
+
+    static constexpr bool supports(uint8_t width, uint8_t height) {
+        return width <= SSD1306_WIDTH && height <= SSD1306_HEIGHT;
+    }
+
+    static bool init(ssd1306_t &dev, ssd1306_config_t config, uint8_t width, uint8_t height) {
+        config.width  = width;
+        config.height = height;
+        return ssd1306_init(&dev, &config);
+    }
+
+    static oled_t       &gfx(ssd1306_t &dev)       { return dev.gfx; }
+    static const oled_t &gfx(const ssd1306_t &dev) { return dev.gfx; }
+};
+
+template <uint8_t Width, uint8_t Height, oled_rotation_t Rotation = OLED_ROTATE_0>
+using ssd1306_display = display<ssd1306, Width, Height, Rotation>;
+
+using ssd1306_128x64 = ssd1306_display<128, 64>;
+using ssd1306_128x32 = ssd1306_display<128, 32>;
+using ssd1306_72x40  = ssd1306_display<72, 40>;
+
+} // namespace oled
+
+#endif // OLED_SSD1306_HPP
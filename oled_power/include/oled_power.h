@@ -0,0 +1,146 @@
+/**
+ * @file oled_power.h
+ * @brief Idle dimming, display-off and rail cut for OLED panels
+ * @version 1.0
+ *
+ * An OLED draws current for every lit pixel, so a panel left on at full
+ * contrast is often the largest load on a battery device. oled_power walks
+ * the panel through deeper states as it stays idle:
+ *
+ *   ACTIVE  full contrast
+ *   DIM     lower contrast after dim_ms
+ *   OFF     display off (controller sleep, RAM kept) after off_ms
+ *   CUT     panel rail switched off through peripheral_power after cut_ms
+ *
+ * Any call to oled_power_activity() restores ACTIVE and restarts the timers.
+ * Before switching off, the bright contrast is restored, so waking from OFF
+ * is a single display-on command and the old frame reappears at once. From
+ * CUT the panel is re-initialized and marked dirty; the next flush repaints.
+ * If it does not answer, it stays CUT and the wake is retried by
+ * oled_power_update().
+ *
+ * Only pass a rail that powers the panel alone. An unpowered panel can clamp
+ * SDA/SCL through its protection diodes, so on a shared bus cut it only if
+ * the other devices can wait until it is powered again. Skip flushes while
+ * oled_power_is_powered() is false.
+ *
+ * Usage:
+ *   oled_power_config_t pcfg = oled_power_create_config();
+ *   pcfg.cut_ms = 10 * 60 * 1000;
+ *   oled_power_init(&pwr, &pcfg, &dev.gfx, &display_rail);
+ *
+ *   for (;;) {
+ *       if (button_pressed()) oled_power_activity(&pwr);
+ *       oled_power_update(&pwr);
+ *       if (oled_power_is_powered(&pwr)) ssd1306_render_framebuffer(&dev, &fb);
+ *   }
+ */
+
+#ifndef OLED_POWER_H
+#define OLED_POWER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "oled_core.h"
+#include "peripheral_power.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// POWER PARAMETERS
+// ============================================================================
+
+#define OLED_POWER_DEFAULT_BRIGHT   0xFF
+#define OLED_POWER_DEFAULT_DIM      0x10
+#define OLED_POWER_DEFAULT_DIM_MS   15000
+#define OLED_POWER_DEFAULT_OFF_MS   60000
+
+// Time for the panel supply to settle after the rail comes back on
+#define OLED_POWER_RAIL_SETTLE_MS   10
+
+// ============================================================================
+// POWER STATE
+// ============================================================================
+
+typedef enum {
+    OLED_POWER_ACTIVE,
+    OLED_POWER_DIM,
+    OLED_POWER_OFF,
+    OLED_POWER_CUT
+} oled_power_state_t;
+
+// Timeouts count from the last activity; 0 disables that step
+typedef struct {
+    uint8_t  bright;        // Contrast while active
+    uint8_t  dim;           // Contrast while dimmed
+    uint32_t dim_ms;
+    uint32_t off_ms;
+    uint32_t cut_ms;        // Needs a rail
+} oled_power_config_t;
+
+typedef struct {
+    oled_power_config_t config;
+    oled_t             *gfx;
+    peripheral_power_t *rail;               // NULL: never cut power
+    oled_power_state_t  state;
+    bool                wake_pending;       // Panel did not answer after the rail came back
+    uint32_t            last_activity_ms;
+} oled_power_t;
+
+// ============================================================================
+// CONVENIENCE INITIALIZER
+// ============================================================================
+
+static inline oled_power_config_t oled_power_create_config(void) {
+    oled_power_config_t cfg = {
+        .bright = OLED_POWER_DEFAULT_BRIGHT,
+        .dim    = OLED_POWER_DEFAULT_DIM,
+        .dim_ms = OLED_POWER_DEFAULT_DIM_MS,
+        .off_ms = OLED_POWER_DEFAULT_OFF_MS,
+        .cut_ms = 0
+    };
+    return cfg;
+}
+
+// ============================================================================
+// FUNCTION DECLARATIONS
+// ============================================================================
+
+// Start ACTIVE at the bright contrast. The panel must be initialized and
+// the rail (if any) initialized and enabled.
+void oled_power_init(oled_power_t *pwr, const oled_power_config_t *config,
+                     oled_t *gfx, peripheral_power_t *rail);
+
+// User input or new content: back to ACTIVE and restart the timers.
+// Returns true if the panel had to be woken. Waking from CUT fails if the
+// panel does not answer its init sequence: the rail is switched off again,
+// the state stays CUT and false is returned; oled_power_update() retries.
+bool oled_power_activity(oled_power_t *pwr);
+
+// Step into the state the idle time calls for; call it periodically
+void oled_power_update(oled_power_t *pwr);
+
+// Change the active contrast; takes effect now if ACTIVE, else on wake
+void oled_power_set_brightness(oled_power_t *pwr, uint8_t bright);
+
+static inline oled_power_state_t oled_power_state(const oled_power_t *pwr) {
+    return pwr->state;
+}
+
+// True after a failed wake from CUT, until a retry succeeds
+static inline bool oled_power_wake_pending(const oled_power_t *pwr) {
+    return pwr->wake_pending;
+}
+
+// False while the rail is cut: nothing on the panel's address answers
+static inline bool oled_power_is_powered(const oled_power_t *pwr) {
+    return pwr->state != OLED_POWER_CUT;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OLED_POWER_H
@@ -0,0 +1,125 @@
+/**
+ * @file oled_power.c
+ * @brief Idle dimming, display-off and rail cut for OLED panels implementation
+ * @version 1.0
+ */
+
+#include "oled_power.h"
+#include "pico/stdlib.h"
+
+// ============================================================================
+// INTERNAL
+// ============================================================================
+
+static uint32_t now_ms(void) {
+    return to_ms_since_boot(get_absolute_time());
+}
+
+// Deepest state the idle time has reached
+static oled_power_state_t target_state(const oled_power_t *pwr, uint32_t idle_ms) {
+    const oled_power_config_t *cfg = &pwr->config;
+
+    if (pwr->rail && cfg->cut_ms && idle_ms >= cfg->cut_ms) return OLED_POWER_CUT;
+    if (cfg->off_ms && idle_ms >= cfg->off_ms)              return OLED_POWER_OFF;
+    if (cfg->dim_ms && idle_ms >= cfg->dim_ms)              return OLED_POWER_DIM;
+    return OLED_POWER_ACTIVE;
+}
+
+static void enter_state(oled_power_t *pwr, oled_power_state_t state) {
+    oled_power_state_t from = pwr->state;
+
+    if (state == OLED_POWER_DIM) {
+        oled_set_contrast(pwr->gfx, pwr->config.dim);
+    } else if (from < OLED_POWER_OFF) {
+        // OFF or CUT. Blank first so the contrast change is not seen; the
+        // bright contrast is then what comes back on wake or re-init.
+        oled_display_on(pwr->gfx, false);
+        if (from == OLED_POWER_DIM) oled_set_contrast(pwr->gfx, pwr->config.bright);
+    }
+
+    if (state == OLED_POWER_CUT) peripheral_power_disable(pwr->rail);
+
+    pwr->state = state;
+}
+
+// Rail on and panel re-initialized. If the panel does not answer, the rail
+// goes off again and the state stays CUT, so nothing flushes to a dead
+// panel; oled_power_update() tries again.
+static bool wake_from_cut(oled_power_t *pwr) {
+    peripheral_power_enable(pwr->rail);
+    sleep_ms(OLED_POWER_RAIL_SETTLE_MS);
+
+    if (!oled_reinit(pwr->gfx)) {
+        peripheral_power_disable(pwr->rail);
+        pwr->wake_pending = true;
+        return false;
+    }
+
+    // The driver's init sequence re-sends the contrast it last had, which
+    // is the bright one; set it again in case it changed since
+    oled_set_contrast(pwr->gfx, pwr->config.bright);
+    pwr->wake_pending = false;
+    pwr->state        = OLED_POWER_ACTIVE;
+    return true;
+}
+
+// ============================================================================
+// POWER MANAGEMENT
+// ============================================================================
+
+void oled_power_init(oled_power_t *pwr, const oled_power_config_t *config,
+                     oled_t *gfx, peripheral_power_t *rail) {
+    pwr->config           = *config;
+    pwr->gfx              = gfx;
+    pwr->rail             = rail;
+    pwr->state            = OLED_POWER_ACTIVE;
+    pwr->wake_pending     = false;
+    pwr->last_activity_ms = now_ms();
+
+    oled_set_contrast(gfx, config->bright);
+}
+
+bool oled_power_activity(oled_power_t *pwr) {
+    oled_power_state_t from = pwr->state;
+
+    pwr->last_activity_ms = now_ms();
+
+    switch (from) {
+        case OLED_POWER_ACTIVE:
+            return false;
+        case OLED_POWER_DIM:
+            oled_set_contrast(pwr->gfx, pwr->config.bright);
+            break;
+        case OLED_POWER_OFF:
+            oled_display_on(pwr->gfx, true);
+            break;
+        case OLED_POWER_CUT:
+            return wake_from_cut(pwr);
+    }
+    pwr->state = OLED_POWER_ACTIVE;
+    return true;
+}
+
+void oled_power_update(oled_power_t *pwr) {
+    // A wake that failed is retried until the panel answers; a successful
+    // retry counts as the activity that asked for it
+    if (pwr->wake_pending) {
+        if (wake_from_cut(pwr)) pwr->last_activity_ms = now_ms();
+        return;
+    }
+
+    oled_power_state_t state = target_state(pwr, now_ms() - pwr->last_activity_ms);
+
+    // Only ever deeper here; oled_power_activity() brings it back
+    if (state > pwr->state) enter_state(pwr, state);
+}
+
+void oled_power_set_brightness(oled_power_t *pwr, uint8_t bright) {
+    pwr->config.bright = bright;
+
+    // While OFF it is sent now so the wake stays a single command;
+    // DIM and CUT pick it up when they wake
+    if (pwr->state == OLED_POWER_ACTIVE || pwr->state == OLED_POWER_OFF) {
+        oled_set_contrast(pwr->gfx, bright);
+    }
+}
@@ -0,0 +1,102 @@
+/**
+ * @file oled_service.h
+ * @brief Double-buffered display service: core0 draws, core1 flushes
+ * @version 1.0
+ *
+ * The service owns two framebuffers. The application draws into the back
+ * buffer through svc->canvas and swaps; core1 sends the finished frame with
+ * the usual dirty-region flush while core0 carries on. Ownership of the
+ * front buffer moves through the multicore FIFO:
+ *
+ *   core0                                  core1
+ *   draw into back buffer
+ *   swap: hand over dirty spans,
+ *         flip buffers, copy front
+ *         into back              --front-->  oled_flush(panel, front)
+ *   draw the next frame                      ...
+ *   next swap waits for          <--done---
+ *
+ * Only one frame is in flight and core0 never touches the buffer core1 is
+ * sending, so frames do not tear. Because the back buffer is refreshed from
+ * the front one at every swap, incremental drawing (charts, counters) works
+ * exactly as with a single buffer.
+ *
+ * While the service runs it uses the FIFO in both directions, and the panel
+ * (its driver, and any other device on the same bus) belongs to core1.
+ * Set rotation and attach a shadow before oled_service_start().
+ *
+ * Usage:
+ *   static oled_service_t svc;
+ *   ssd1306_config_t cfg = ssd1306_create_config(i2c0, 16, 17);
+ *   ssd1306_init(&dev, &cfg);
+ *   oled_service_start(&svc, &dev.gfx);
+ *   for (;;) {
+ *       int32_t sample = acquire();
+ *       oled_chart_push(&svc.canvas, oled_service_buffer(&svc), &chart, sample);
+ *       oled_service_try_swap(&svc);    // never blocks; unsent changes stay dirty
+ *   }
+ */
+
+#ifndef OLED_SERVICE_H
+#define OLED_SERVICE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "oled_core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// SERVICE STATE
+// ============================================================================
+
+typedef struct {
+    // Driver's core, only used by core1 while the service runs
+    oled_t             *panel;
+
+    // Drawing state for core0: same geometry as the panel, own dirty spans
+    oled_t              canvas;
+
+    oled_framebuffer_t  fb[2];
+    uint8_t             back;       // Buffer core0 draws into
+    bool                in_flight;  // core1 owns the other buffer
+    bool                running;
+} oled_service_t;
+
+// ============================================================================
+// FUNCTION DECLARATIONS
+// ============================================================================
+
+// Start core1 and take over the panel. Both buffers start blank and the
+// first swap sends the whole screen.
+void oled_service_start(oled_service_t *svc, oled_t *panel);
+
+// Wait for the frame in flight, stop core1 and hand the panel back. Changes
+// drawn since the last swap stay marked dirty on the panel.
+void oled_service_stop(oled_service_t *svc);
+
+// Buffer to draw into; it changes at every swap
+static inline uint8_t *oled_service_buffer(oled_service_t *svc) {
+    return svc->fb[svc->back].data;
+}
+
+// Hand the back buffer to core1. try_swap returns false instead of waiting
+// when the previous frame is still being sent; drawing can simply continue
+// and the next swap sends both frames' changes. A swap with nothing dirty
+// sends nothing.
+bool oled_service_try_swap(oled_service_t *svc);
+void oled_service_swap(oled_service_t *svc);
+
+// True while core1 is still sending; never blocks
+bool oled_service_poll(oled_service_t *svc);
+
+// Block until the frame in flight has been sent
+void oled_service_wait(oled_service_t *svc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OLED_SERVICE_H
@@ -0,0 +1,145 @@
+/**
+ * @file oled_service.c
+ * @brief Double-buffered display service implementation
+ * @version 1.0
+ */
+
+#include "oled_service.h"
+#include "pico/multicore.h"
+#include "hardware/sync.h"
+
+// FIFO words from core0: a buffer index to flush, or STOP.
+// From core1: DONE after every flush and once more on the way out.
+#define SERVICE_STOP    0xFFFFFFFFu
+#define SERVICE_DONE    0xD15Au
+
+// ============================================================================
+// CORE 1
+// ============================================================================
+
+// The service pointer goes through the FIFO a word at a time: one word on
+// the RP2040, two where pointers are 64-bit (host tests)
+#define SERVICE_PTR_WORDS   (sizeof(uintptr_t) / sizeof(uint32_t))
+
+static void push_service(oled_service_t *svc) {
+    uintptr_t p = (uintptr_t)svc;
+    for (unsigned i = 0; i < SERVICE_PTR_WORDS; i++) {
+        multicore_fifo_push_blocking((uint32_t)(p >> (32 * i)));
+    }
+}
+
+static oled_service_t *pop_service(void) {
+    uintptr_t p = 0;
+    for (unsigned i = 0; i < SERVICE_PTR_WORDS; i++) {
+        p |= (uintptr_t)multicore_fifo_pop_blocking() << (32 * i);
+    }
+    return (oled_service_t *)p;
+}
+
+static void core1_main(void) {
+    // Launch is followed by the service pointer, so no global is needed
+    oled_service_t *svc = pop_service();
+
+    for (;;) {
+        uint32_t cmd = multicore_fifo_pop_blocking();
+        if (cmd == SERVICE_STOP) break;
+
+        __dmb();    // Frame written by core0 before the index was pushed
+        oled_flush(svc->panel, &svc->fb[cmd]);
+        __dmb();    // Flush (and its borrowed control byte) done before DONE
+        multicore_fifo_push_blocking(SERVICE_DONE);
+    }
+    multicore_fifo_push_blocking(SERVICE_DONE);
+}
+
+// ============================================================================
+// INTERNAL
+// ============================================================================
+
+// Move the canvas dirty spans onto the panel. Both share one geometry, so
+// spans carry over as they are; the flush maps them to panel pages.
+static void hand_over_dirty(oled_service_t *svc) {
+    for (int page = 0; page < svc->canvas.height / OLED_PAGE_HEIGHT; page++) {
+        uint8_t start = svc->canvas.dirty_start[page];
+        uint8_t end   = svc->canvas.dirty_end[page];
+        if (start > end) continue;
+
+        oled_mark_dirty(svc->panel, start, page * OLED_PAGE_HEIGHT,
+                        end, page * OLED_PAGE_HEIGHT + OLED_PAGE_HEIGHT - 1);
+    }
+    oled_clear_dirty(&svc->canvas);
+}
+
+// ============================================================================
+// SERVICE
+// ============================================================================
+
+void oled_service_start(oled_service_t *svc, oled_t *panel) {
+    oled_wait_idle(panel);
+
+    // The canvas never talks to the controller: drawing only needs the
+    // geometry, and flushing is core1's job
+    svc->panel            = panel;
+    svc->canvas           = *panel;
+    svc->canvas.shadow    = NULL;
+    svc->canvas.busy      = false;
+    oled_mark_all_dirty(&svc->canvas);
+
+    memset(svc->fb, 0, sizeof(svc->fb));
+    svc->back      = 0;
+    svc->in_flight = false;
+    svc->running   = true;
+
+    multicore_launch_core1(core1_main);
+    push_service(svc);
+}
+
+void oled_service_stop(oled_service_t *svc) {
+    if (!svc->running) return;
+
+    oled_service_wait(svc);
+    multicore_fifo_push_blocking(SERVICE_STOP);
+    multicore_fifo_pop_blocking();
+    multicore_reset_core1();
+
+    hand_over_dirty(svc);
+    svc->running = false;
+}
+
+bool oled_service_poll(oled_service_t *svc) {
+    if (svc->in_flight && multicore_fifo_rvalid()) {
+        multicore_fifo_pop_blocking();
+        __dmb();
+        svc->in_flight = false;
+    }
+    return svc->in_flight;
+}
+
+void oled_service_wait(oled_service_t *svc) {
+    if (!svc->in_flight) return;
+
+    multicore_fifo_pop_blocking();
+    __dmb();
+    svc->in_flight = false;
+}
+
+bool oled_service_try_swap(oled_service_t *svc) {
+    if (oled_service_poll(svc)) return false;
+    if (!oled_is_dirty(&svc->canvas)) return true;
+
+    // core1 is idle, so both buffers and the panel's dirty spans are ours
+    uint8_t front = svc->back;
+    hand_over_dirty(svc);
+    svc->back = front ^ 1;
+    memcpy(svc->fb[svc->back].data, svc->fb[front].data, OLED_BUF_LEN);
+
+    __dmb();
+    svc->in_flight = true;
+    multicore_fifo_push_blocking(front);
+    return true;
+}
+
+void oled_service_swap(oled_service_t *svc) {
+    oled_service_wait(svc);
+    oled_service_try_swap(svc);
+}
@@ -3,6 +3,10 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 typedef struct {
     uint8_t gate_pin;   // GPIO pin controlling the MOSFET gate
     bool start_enabled; // Whether to start with power enabled
@@ -46,4 +50,8 @@ bool peripheral_power_enable(peripheral_power_t *power);
  * 
  * @returns 1 if power was successfully disabled, 0 if already disabled, -1 if not initialized
  */
-bool peripheral_power_disable(peripheral_power_t *power);
\ No newline at end of file
+bool peripheral_power_disable(peripheral_power_t *power);
+
+#ifdef __cplusplus
+}
+#endif
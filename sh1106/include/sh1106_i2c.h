@@ -2,12 +2,15 @@
  * @file sh1106_i2c.h
  * @author LVDT Logger Project
  * @brief SH1106 OLED Display I2C Driver Header (1.3" 128x64)
- * @version 1.0
+ * @version 2.0
  * @date 2025-08-27
- * 
+ *
  * Driver for SH1106 controller-based OLED displays (commonly 1.3" 128x64).
  * Similar to SSD1306 but with different addressing and initialization.
- * 
+ *
+ * Instance-based driver. All state lives in sh1106_t.
+ * No global variables, no compile-time pin configuration.
+ *
  * @copyright Copyright (c) 2025
  */
 
@@ -17,42 +20,35 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <string.h>
+#include "hardware/i2c.h"
+#include "oled_core.h"
 
-// Display dimensions
-#define SH1106_HEIGHT              64
-#define SH1106_WIDTH               128
-
-// Default I2C pins (can be overridden in your project)
-#ifndef SH1106_I2C_SDA_PIN
-#define SH1106_I2C_SDA_PIN         16   // GP16 (pin 16)
-#endif
-
-#ifndef SH1106_I2C_SCL_PIN
-#define SH1106_I2C_SCL_PIN         17   // GP17 (pin 17)
-#endif
-
-#ifndef SH1106_I2C_ADDR
-#define SH1106_I2C_ADDR            0x3C
+#ifdef __cplusplus
+extern "C" {
 #endif
 
-#ifndef SH1106_I2C_INSTANCE
-#define SH1106_I2C_INSTANCE i2c0
-#endif
+// ============================================================================
+// DISPLAY PARAMETERS
+// ============================================================================
 
-// I2C clock frequency (400kHz is standard, can go up to 1MHz for faster updates)
-#ifndef SH1106_I2C_CLK
-#define SH1106_I2C_CLK             400
-#endif
+#define SH1106_HEIGHT              OLED_HEIGHT
+#define SH1106_WIDTH               OLED_WIDTH
+#define SH1106_PAGE_HEIGHT         OLED_PAGE_HEIGHT
+#define SH1106_NUM_PAGES           OLED_NUM_PAGES
+#define SH1106_BUF_LEN             OLED_BUF_LEN
 
-// Display parameters
-#define SH1106_PAGE_HEIGHT         8
-#define SH1106_NUM_PAGES           (SH1106_HEIGHT / SH1106_PAGE_HEIGHT)
-#define SH1106_BUF_LEN             (SH1106_NUM_PAGES * SH1106_WIDTH)
+#define SH1106_DEFAULT_ADDRESS     0x3C
+#define SH1106_DEFAULT_BAUDRATE    400000
+#define SH1106_DEFAULT_CONTRAST    0xFF
 
 // SH1106 specific constants
-#define SH1106_COLUMN_OFFSET       2    ///< SH1106 has a 2-pixel column offset
+#define SH1106_COLUMN_OFFSET       2    ///< 132-column RAM, 128 visible columns start at 2
+
+// ============================================================================
+// COMMANDS
+// ============================================================================
 
-// SH1106 Commands (many are same as SSD1306, some are different)
+// Many are the same as SSD1306, some are different
 #define SH1106_SET_COL_ADDR_LOW    0x00  // Set column address low nibble
 #define SH1106_SET_COL_ADDR_HIGH   0x10  // Set column address high nibble
 #define SH1106_SET_MEM_MODE        0x20
@@ -87,150 +83,175 @@
 #define SH1106_WRITE_MODE          0xFE
 #define SH1106_READ_MODE           0xFF
 
-/**
- * @brief Structure defining a render area on the display
- */
-struct sh1106_render_area {
+// ============================================================================
+// RENDER AREA
+// ============================================================================
+
+typedef struct {
     uint8_t start_col;      ///< Starting column (0-127)
     uint8_t end_col;        ///< Ending column (0-127)
     uint8_t start_page;     ///< Starting page (0-7)
     uint8_t end_page;       ///< Ending page (0-7)
-    int buflen;             ///< Buffer length for this area (calculated)
-};
-
-// Core SH1106 Functions
-/**
- * @brief Send a single command to the SH1106
- * @param cmd Command byte to send
- */
-void SH1106_send_cmd(uint8_t cmd);
-
-/**
- * @brief Send a list of commands to the SH1106
- * @param buf Array of command bytes
- * @param num Number of commands in the array
- */
-void SH1106_send_cmd_list(uint8_t *buf, int num);
-
-/**
- * @brief Send a buffer of display data to the SH1106
- * @param buf Buffer containing display data
- * @param buflen Length of the buffer
- */
-void SH1106_send_buf(uint8_t buf[], int buflen);
-
-/**
- * @brief Initialize the SH1106 display
- * Must be called before any other display operations
- */
-void SH1106_init(void);
-
-/**
- * @brief Enable or disable horizontal scrolling
- * @param on true to enable scrolling, false to disable
- */
-void SH1106_scroll(bool on);
-
-// Render Functions
-/**
- * @brief Calculate the buffer length needed for a render area
- * @param area Pointer to render area structure
- */
-void sh1106_calc_render_area_buflen(struct sh1106_render_area *area);
-
-/**
- * @brief Render a buffer to a specific area of the display
- * @param buf Buffer containing display data
- * @param area Render area to update
- */
-void sh1106_render(uint8_t *buf, struct sh1106_render_area *area);
-
-/**
- * @brief Render full screen buffer (optimized for SH1106 page mode)
- * @param buf Display buffer
- */
-void sh1106_render_full_screen(uint8_t *buf);
-
-// Graphics Functions (same interface as SSD1306 for compatibility)
-/**
- * @brief Set or clear a pixel in the display buffer
- * @param buf Display buffer
- * @param x X coordinate (0-127)
- * @param y Y coordinate (0-63)
- * @param on true to set pixel, false to clear pixel
- */
-void SH1106_SetPixel(uint8_t *buf, int x, int y, bool on);
-
-/**
- * @brief Draw a line in the display buffer
- * @param buf Display buffer
- * @param x0 Starting X coordinate
- * @param y0 Starting Y coordinate
- * @param x1 Ending X coordinate
- * @param y1 Ending Y coordinate
- * @param on true to draw line, false to erase line
- */
-void SH1106_DrawLine(uint8_t *buf, int x0, int y0, int x1, int y1, bool on);
-
-/**
- * @brief Write a character to the display buffer at any Y position
- * @param buf Display buffer
- * @param x X coordinate (0 to SH1106_WIDTH-8)
- * @param y Y coordinate (0 to SH1106_HEIGHT-8)
- * @param ch Character to write
- */
-void SH1106_WriteChar(uint8_t *buf, int16_t x, int16_t y, uint8_t ch);
-
-/**
- * @brief Write a string to the display buffer at any Y position
- * @param buf Display buffer
- * @param x Starting X coordinate
- * @param y Y coordinate (can be any value 0 to SH1106_HEIGHT-8)
- * @param str Null-terminated string to write
- */
-void SH1106_WriteString(uint8_t *buf, int16_t x, int16_t y, char *str);
-
-/**
- * @brief Write centered text
- * @param buf Display buffer  
- * @param y Y coordinate
- * @param str String to center
- */
-void SH1106_WriteCentered(uint8_t *buf, int16_t y, char *str);
+    int     buflen;         ///< Buffer length for this area (calculated)
+} sh1106_render_area_t;
+
+#define SH1106_FULL_SCREEN_AREA() ((sh1106_render_area_t){ \
+    .start_col  = 0,                    \
+    .end_col    = SH1106_WIDTH - 1,     \
+    .start_page = 0,                    \
+    .end_page   = SH1106_NUM_PAGES - 1, \
+    .buflen     = SH1106_BUF_LEN        \
+})
+
+// ============================================================================
+// BUFFER MACROS
+// ============================================================================
+
+#define SH1106_CLEAR_BUFFER(buf) memset(buf, 0x00, SH1106_BUF_LEN)
+#define SH1106_FILL_BUFFER(buf)  memset(buf, 0xFF, SH1106_BUF_LEN)
+
+// ============================================================================
+// FRAMEBUFFER
+// ============================================================================
+
+// Zero-copy framebuffer, see oled_framebuffer_t. Draw into fb.data.
+typedef oled_framebuffer_t sh1106_framebuffer_t;
+
+// ============================================================================
+// CONFIG AND DEVICE STRUCTS
+// ============================================================================
+
+typedef struct {
+    i2c_inst_t *i2c;
+    uint8_t     sda_pin;
+    uint8_t     scl_pin;
+    uint8_t     address;
+    uint32_t    baudrate;
+    bool        shared_bus;     // Bus set up elsewhere (e.g. oled_bus): leave it alone
+} sh1106_config_t;
+
+typedef struct {
+    sh1106_config_t config;
+    bool            initialized;
+    uint8_t         contrast;   // Re-sent by the init sequence
+    oled_t          gfx;        // Dirty tracking (oled_core)
+} sh1106_t;
+
+// ============================================================================
+// CONVENIENCE INITIALIZER
+// ============================================================================
+
+static inline sh1106_config_t sh1106_create_config(
+        i2c_inst_t *i2c, uint8_t sda_pin, uint8_t scl_pin) {
+    sh1106_config_t cfg = {
+        .i2c        = i2c,
+        .sda_pin    = sda_pin,
+        .scl_pin    = scl_pin,
+        .address    = SH1106_DEFAULT_ADDRESS,
+        .baudrate   = SH1106_DEFAULT_BAUDRATE,
+        .shared_bus = false
+    };
+    return cfg;
+}
 
-/**
- * @brief Write multiple lines of text with custom line spacing
- * @param buf Display buffer
- * @param x Starting X coordinate
- * @param y Starting Y coordinate
- * @param lines Array of strings (null-terminated)
- * @param line_count Number of lines in the array
- * @param line_spacing Pixels between lines (e.g., 10 for tight spacing, 12 for normal)
- */
-void SH1106_WriteLines(uint8_t *buf, int16_t x, int16_t y, char **lines, int line_count, int line_spacing);
+// ============================================================================
+// FUNCTION DECLARATIONS
+// ============================================================================
+
+// Initialization
+bool sh1106_init(sh1106_t *dev, const sh1106_config_t *config);
+void sh1106_deinit(sh1106_t *dev);
+bool sh1106_is_present(sh1106_t *dev);
+
+// Display control
+void sh1106_display_on(sh1106_t *dev, bool on);
+void sh1106_set_contrast(sh1106_t *dev, uint8_t contrast);     // 0x00-0xFF, kept across oled_reinit()
+void sh1106_scroll(sh1106_t *dev, bool on);
+
+// Rotation (clockwise). 180 uses the controller's remap bits; at 90/270 the
+// canvas is 64x128 (dev->gfx.width x height) and is transposed on flush.
+// Redraw the buffer after switching between landscape and portrait.
+static inline bool sh1106_set_rotation(sh1106_t *dev, oled_rotation_t rotation) {
+    return oled_set_rotation(&dev->gfx, rotation);
+}
 
-// Helper Macros
-/**
- * @brief Create a full-screen render area
- */
-#define SH1106_FULL_SCREEN_AREA() { \
-    .start_col = 0, \
-    .end_col = SH1106_WIDTH - 1, \
-    .start_page = 0, \
-    .end_page = SH1106_NUM_PAGES - 1, \
-    .buflen = 0 \
+// Rendering
+void sh1106_calc_render_area_buflen(sh1106_render_area_t *area);
+void sh1106_render(sh1106_t *dev, uint8_t *buf, sh1106_render_area_t *area);
+void sh1106_render_full_screen(sh1106_t *dev, uint8_t *buf);
+void sh1106_render_framebuffer(sh1106_t *dev, sh1106_framebuffer_t *fb);
+
+// Dirty tracking
+// Graphics calls mark what they touch. Code that writes the buffer directly
+// (e.g. SH1106_CLEAR_BUFFER) must call sh1106_mark_dirty/mark_all_dirty.
+static inline void sh1106_mark_dirty(sh1106_t *dev, int x0, int y0, int x1, int y1) {
+    oled_mark_dirty(&dev->gfx, x0, y0, x1, y1);
+}
+static inline void sh1106_mark_all_dirty(sh1106_t *dev) { oled_mark_all_dirty(&dev->gfx); }
+static inline void sh1106_clear_dirty(sh1106_t *dev) { oled_clear_dirty(&dev->gfx); }
+static inline bool sh1106_is_dirty(const sh1106_t *dev) { return oled_is_dirty(&dev->gfx); }
+static inline void sh1106_flush(sh1106_t *dev, sh1106_framebuffer_t *fb) { oled_flush(&dev->gfx, fb); }
+
+// Shadow frame
+// With a shadow attached, flushes send only bytes that differ from what the
+// panel already shows - useful when every frame is cleared and redrawn.
+static inline void sh1106_set_shadow(sh1106_t *dev, oled_shadow_t *shadow) {
+    oled_set_shadow(&dev->gfx, shadow);
 }
 
-/**
- * @brief Clear entire display buffer
- * @param buf Display buffer to clear
- */
-#define SH1106_CLEAR_BUFFER(buf) memset(buf, 0, SH1106_BUF_LEN)
+// Graphics and text
+// Thin wrappers over oled_core; every oled_* drawing call can also be used
+// directly on &dev->gfx.
+static inline void sh1106_set_pixel(sh1106_t *dev, uint8_t *buf, int x, int y, bool on) {
+    oled_set_pixel(&dev->gfx, buf, x, y, on);
+}
+static inline void sh1106_draw_line(sh1106_t *dev, uint8_t *buf, int x0, int y0, int x1, int y1, bool on) {
+    oled_draw_line(&dev->gfx, buf, x0, y0, x1, y1, on);
+}
+static inline void sh1106_draw_hline(sh1106_t *dev, uint8_t *buf, int x, int y, int w, bool on) {
+    oled_draw_hline(&dev->gfx, buf, x, y, w, on);
+}
+static inline void sh1106_draw_vline(sh1106_t *dev, uint8_t *buf, int x, int y, int h, bool on) {
+    oled_draw_vline(&dev->gfx, buf, x, y, h, on);
+}
+static inline void sh1106_draw_rect(sh1106_t *dev, uint8_t *buf, int x, int y, int w, int h, bool on) {
+    oled_draw_rect(&dev->gfx, buf, x, y, w, h, on);
+}
+static inline void sh1106_fill_rect(sh1106_t *dev, uint8_t *buf, int x, int y, int w, int h, bool on) {
+    oled_fill_rect(&dev->gfx, buf, x, y, w, h, on);
+}
+static inline void sh1106_clear_area(sh1106_t *dev, uint8_t *buf, int x, int y, int w, int h) {
+    oled_clear_area(&dev->gfx, buf, x, y, w, h);
+}
+static inline void sh1106_blit(sh1106_t *dev, uint8_t *buf, int x, int y, const oled_bitmap_t *bmp, oled_rop_t rop) {
+    oled_blit(&dev->gfx, buf, x, y, bmp, rop);
+}
+static inline void sh1106_draw_label(sh1106_t *dev, uint8_t *buf, int x, int y, const oled_label_t *label) {
+    oled_draw_label(&dev->gfx, buf, x, y, label);
+}
+static inline void sh1106_write_char(sh1106_t *dev, uint8_t *buf, int16_t x, int16_t y, uint8_t ch) {
+    oled_write_char(&dev->gfx, buf, x, y, ch);
+}
+static inline void sh1106_write_string(sh1106_t *dev, uint8_t *buf, int16_t x, int16_t y, const char *str) {
+    oled_write_string(&dev->gfx, buf, x, y, str);
+}
+static inline void sh1106_write_centered(sh1106_t *dev, uint8_t *buf, int16_t y, const char *str) {
+    oled_write_centered(&dev->gfx, buf, y, str);
+}
+static inline void sh1106_write_int(sh1106_t *dev, uint8_t *buf, int16_t x, int16_t y, int32_t value, uint8_t width) {
+    oled_write_int(&dev->gfx, buf, x, y, value, width);
+}
+static inline void sh1106_write_fixed(sh1106_t *dev, uint8_t *buf, int16_t x, int16_t y,
+                                      int32_t value, uint8_t decimals, uint8_t width) {
+    oled_write_fixed(&dev->gfx, buf, x, y, value, decimals, width);
+}
+static inline void sh1106_write_lines(sh1106_t *dev, uint8_t *buf, int16_t x, int16_t y,
+                                      const char **lines, int line_count, int line_spacing) {
+    oled_write_lines(&dev->gfx, buf, x, y, lines, line_count, line_spacing);
+}
 
-/**
- * @brief Fill entire display buffer
- * @param buf Display buffer to fill
- */
-#define SH1106_FILL_BUFFER(buf) memset(buf, 0xFF, SH1106_BUF_LEN)
+#ifdef __cplusplus
+}
+#endif
 
-#endif // SH1106_I2C_H
\ No newline at end of file
+#endif // SH1106_I2C_H
@@ -2,60 +2,76 @@
  * @file sh1106_i2c.c
  * @author LVDT Logger Project
  * @brief SH1106 OLED Display I2C Driver Implementation (1.3" 128x64)
- * @version 1.0
+ * @version 2.0
  * @date 2025-08-27
- * 
+ *
  * Implementation of SH1106 controller driver for 1.3" OLED displays.
  * Handles the differences from SSD1306 including column offset and page addressing.
- * 
+ *
  * @copyright Copyright (c) 2025
  */
 
-#include <stdio.h>
-#include <string.h>
-#include <stdlib.h>
-#include <ctype.h>
-#include "pico/stdlib.h"
-#include "pico/binary_info.h"
-#include "hardware/i2c.h"
-#include "sh1106_font.h"
 #include "sh1106_i2c.h"
+#include "hardware/gpio.h"
+#include "pico/stdlib.h"
+#include <string.h>
 
-void sh1106_calc_render_area_buflen(struct sh1106_render_area *area) {
-    // calculate how long the flattened buffer will be for a render area
-    area->buflen = (area->end_col - area->start_col + 1) * (area->end_page - area->start_page + 1);
-}
+// ============================================================================
+// INTERNAL: LOW-LEVEL I2C
+// ============================================================================
 
-void SH1106_send_cmd(uint8_t cmd) {
+static void send_cmd(sh1106_t *dev, uint8_t cmd) {
     // I2C write process expects a control byte followed by data
     // this "data" can be a command or data to follow up a command
     // Co = 1, D/C = 0 => the driver expects a command
     uint8_t buf[2] = {0x80, cmd};
-    i2c_write_blocking(SH1106_I2C_INSTANCE, SH1106_I2C_ADDR, buf, 2, false);
+    i2c_write_blocking(dev->config.i2c, dev->config.address, buf, 2, false);
 }
 
-void SH1106_send_cmd_list(uint8_t *buf, int num) {
-    for (int i = 0; i < num; i++)
-        SH1106_send_cmd(buf[i]);
+static void send_cmd_list(sh1106_t *dev, uint8_t *cmds, int count) {
+    for (int i = 0; i < count; i++) {
+        send_cmd(dev, cmds[i]);
+    }
 }
 
-void SH1106_send_buf(uint8_t buf[], int buflen) {
-    // For SH1106, we need to send data differently than SSD1306
-    // SH1106 works better with page addressing mode
-    
-    uint8_t *temp_buf = malloc(buflen + 1);
-    temp_buf[0] = 0x40; // Data mode
-    memcpy(temp_buf + 1, buf, buflen);
+static void send_buf(sh1106_t *dev, uint8_t *buf, int buflen) {
+    // Prepend the data control byte (0x40) without heap allocation.
+    // Data is always sent one page at a time, so a page is the worst case.
+    uint8_t tmp[SH1106_WIDTH + 1];
+    tmp[0] = 0x40;
+    memcpy(tmp + 1, buf, buflen);
+    i2c_write_blocking(dev->config.i2c, dev->config.address, tmp, buflen + 1, false);
+}
 
-    i2c_write_blocking(SH1106_I2C_INSTANCE, SH1106_I2C_ADDR, temp_buf, buflen + 1, false);
+static void send_framebuffer_slice(sh1106_t *dev, uint8_t *data, int len) {
+    // data points into sh1106_framebuffer_t, so data[-1] is always valid
+    // (fb->control for the first byte, otherwise the previous pixel byte).
+    // Borrow it for the control byte and put the pixels back afterwards.
+    uint8_t saved = data[-1];
+    data[-1] = 0x40;
+    i2c_write_blocking(dev->config.i2c, dev->config.address, data - 1, len + 1, false);
+    data[-1] = saved;
+}
 
-    free(temp_buf);
+static void set_page_col(sh1106_t *dev, uint8_t page, uint8_t col) {
+    // SH1106 has no horizontal addressing mode: every page is addressed
+    // explicitly and the visible area starts SH1106_COLUMN_OFFSET columns in
+    uint8_t ram_col = col + SH1106_COLUMN_OFFSET;
+    uint8_t cmds[] = {
+        SH1106_SET_PAGE_START    | page,
+        SH1106_SET_COL_ADDR_LOW  | (ram_col & 0x0F),
+        SH1106_SET_COL_ADDR_HIGH | ((ram_col >> 4) & 0x0F)
+    };
+    send_cmd_list(dev, cmds, count_of(cmds));
 }
 
-void SH1106_init() {
-    printf("Initializing SH1106 1.3\" OLED display...\n");
-    
-    // SH1106 initialization sequence
+// ============================================================================
+// INTERNAL: OLED_CORE BACKEND
+// ============================================================================
+
+static bool send_init_sequence(sh1106_t *dev) {
+    if (!sh1106_is_present(dev)) return false;
+
     uint8_t cmds[] = {
         SH1106_SET_DISP,               // Display OFF
         SH1106_SET_DISP_CLK_DIV,       // Set display clock divide ratio/oscillator frequency
@@ -74,7 +90,7 @@ void SH1106_init() {
         SH1106_SET_COM_PIN_CFG,        // Set COM pins hardware configuration
         0x12,                          // Alternative COM pin config for 128x64
         SH1106_SET_CONTRAST,           // Set contrast control
-        0xFF,                          // Maximum contrast
+        dev->contrast,                 // Maximum unless changed
         SH1106_SET_PRECHARGE,          // Set pre-charge period
         0xF1,                          // Default
         SH1106_SET_VCOM_DESEL,         // Set VCOMH deselect level
@@ -85,160 +101,175 @@ void SH1106_init() {
         SH1106_SET_DISP | 0x01         // Display ON
     };
 
-    SH1106_send_cmd_list(cmds, count_of(cmds));
-    
-    printf("SH1106 display initialized successfully\n");
+    send_cmd_list(dev, cmds, count_of(cmds));
+    return true;
 }
 
-void SH1106_scroll(bool on) {
-    // SH1106 scrolling configuration (similar to SSD1306 but may behave differently)
-    uint8_t cmds[] = {
-        SH1106_SET_HORIZ_SCROLL | 0x00,
-        0x00, // dummy byte
-        0x00, // start page 0
-        0x00, // time interval
-        SH1106_NUM_PAGES - 1, // end page
-        0x00, // dummy byte
-        0xFF, // dummy byte
-        SH1106_SET_SCROLL | (on ? 0x01 : 0) // Start/stop scrolling
-    };
+static bool backend_init(void *ctx) {
+    return send_init_sequence((sh1106_t *)ctx);
+}
+
+static void backend_set_window(void *ctx, uint8_t page, uint8_t start_col, uint8_t end_col) {
+    (void)end_col;  // Page addressing: the write simply stops after the data
+    set_page_col((sh1106_t *)ctx, page, start_col);
+}
 
-    SH1106_send_cmd_list(cmds, count_of(cmds));
+static void backend_send_data(void *ctx, uint8_t *data, int len) {
+    send_framebuffer_slice((sh1106_t *)ctx, data, len);
 }
 
-void sh1106_render(uint8_t *buf, struct sh1106_render_area *area) {
-    // SH1106 rendering with column offset
+static void backend_set_flip(void *ctx, bool flip_x, bool flip_y) {
+    // The 2-column offset stays put: the visible 128 columns are centred in
+    // the 132-column RAM, so mirroring maps them onto themselves
     uint8_t cmds[] = {
-        SH1106_SET_COL_ADDR,
-        area->start_col + SH1106_COLUMN_OFFSET,  // Add SH1106 column offset
-        area->end_col + SH1106_COLUMN_OFFSET,    // Add SH1106 column offset
-        SH1106_SET_PAGE_ADDR,
-        area->start_page,
-        area->end_page
+        SH1106_SET_SEG_REMAP   | (flip_x ? 0x00 : 0x01),
+        SH1106_SET_COM_OUT_DIR | (flip_y ? 0x00 : 0x08),
     };
+    send_cmd_list((sh1106_t *)ctx, cmds, count_of(cmds));
+}
 
-    SH1106_send_cmd_list(cmds, count_of(cmds));
-    SH1106_send_buf(buf, area->buflen);
+static void backend_set_contrast(void *ctx, uint8_t contrast) {
+    sh1106_set_contrast((sh1106_t *)ctx, contrast);
 }
 
-void sh1106_render_full_screen(uint8_t *buf) {
-    // Optimized full screen rendering using page addressing mode (SH1106's preferred mode)
-    for (int page = 0; page < SH1106_NUM_PAGES; page++) {
-        // Set page address
-        SH1106_send_cmd(SH1106_SET_PAGE_START + page);
-        
-        // Set column address with offset
-        SH1106_send_cmd(SH1106_SET_COL_ADDR_LOW | (SH1106_COLUMN_OFFSET & 0x0F));
-        SH1106_send_cmd(SH1106_SET_COL_ADDR_HIGH | ((SH1106_COLUMN_OFFSET >> 4) & 0x0F));
-        
-        // Send page data
-        SH1106_send_buf(&buf[page * SH1106_WIDTH], SH1106_WIDTH);
-    }
+static void backend_set_display_on(void *ctx, bool on) {
+    sh1106_display_on((sh1106_t *)ctx, on);
 }
 
-void SH1106_SetPixel(uint8_t *buf, int x, int y, bool on) {
-    // Same pixel manipulation as SSD1306 - the buffer format is identical
-    if (x < 0 || x >= SH1106_WIDTH || y < 0 || y >= SH1106_HEIGHT) {
-        return; // Bounds check
-    }
+static const oled_backend_t sh1106_backend = {
+    .init           = backend_init,
+    .set_window     = backend_set_window,
+    .send_data      = backend_send_data,
+    .wait_idle      = NULL,
+    .set_flip       = backend_set_flip,
+    .set_contrast   = backend_set_contrast,
+    .set_display_on = backend_set_display_on,
+};
+
+// ============================================================================
+// INITIALIZATION
+// ============================================================================
+
+bool sh1106_init(sh1106_t *dev, const sh1106_config_t *config) {
+    if (!dev || !config) return false;
+
+    dev->config      = *config;
+    dev->initialized = false;
+    dev->contrast    = SH1106_DEFAULT_CONTRAST;
 
-    // The video ram on the SH1106 is split up in to 8 rows, one bit per pixel.
-    // Each row is 128 long by 8 pixels high, each byte vertically arranged
-    const int BytesPerRow = SH1106_WIDTH;
-    
-    int byte_idx = (y / 8) * BytesPerRow + x;
-    uint8_t byte = buf[byte_idx];
-
-    if (on)
-        byte |= 1 << (y % 8);
-    else
-        byte &= ~(1 << (y % 8));
-
-    buf[byte_idx] = byte;
-}
-
-// Basic Bresenhams line algorithm
-void SH1106_DrawLine(uint8_t *buf, int x0, int y0, int x1, int y1, bool on) {
-    int dx = abs(x1 - x0);
-    int sx = x0 < x1 ? 1 : -1;
-    int dy = -abs(y1 - y0);
-    int sy = y0 < y1 ? 1 : -1;
-    int err = dx + dy;
-    int e2;
-
-    while (true) {
-        SH1106_SetPixel(buf, x0, y0, on);
-        if (x0 == x1 && y0 == y1)
-            break;
-        e2 = 2 * err;
-
-        if (e2 >= dy) {
-            err += dy;
-            x0 += sx;
-        }
-        if (e2 <= dx) {
-            err += dx;
-            y0 += sy;
-        }
+    oled_bind(&dev->gfx, &sh1106_backend, dev);
+
+    // On a shared bus the owner has set up the I2C block and pins once;
+    // i2c_init() here would reset them under the other devices
+    if (!dev->config.shared_bus) {
+        i2c_init(dev->config.i2c, dev->config.baudrate);
+        gpio_set_function(dev->config.sda_pin, GPIO_FUNC_I2C);
+        gpio_set_function(dev->config.scl_pin, GPIO_FUNC_I2C);
+        gpio_pull_up(dev->config.sda_pin);
+        gpio_pull_up(dev->config.scl_pin);
     }
+
+    sleep_ms(10);
+
+    if (!send_init_sequence(dev)) return false;
+
+    dev->initialized = true;
+    return true;
 }
 
-void SH1106_WriteChar(uint8_t *buf, int16_t x, int16_t y, uint8_t ch) {
-    // Bounds checking
-    if (x < 0 || x > SH1106_WIDTH - 8 || y < 0 || y > SH1106_HEIGHT - 8) {
-        return;
-    }
+void sh1106_deinit(sh1106_t *dev) {
+    if (!dev || !dev->initialized) return;
+
+    send_cmd(dev, SH1106_SET_DISP);     // Display off
 
-    // Get font data for this character (reuse existing font)
-    ch = toupper(ch);
-    int font_idx = GetFontIndex(ch);
-    
-    // Process each column of the 8x8 character
-    for (int col = 0; col < 8; col++) {
-        uint8_t font_col = font[font_idx * 8 + col];  // Get font column data
-        
-        // Process each pixel in this column
-        for (int row = 0; row < 8; row++) {
-            if (font_col & (1 << row)) {  // If this pixel should be set
-                int pixel_x = x + col;
-                int pixel_y = y + row;
-                
-                // Make sure pixel is within bounds
-                if (pixel_x < SH1106_WIDTH && pixel_y < SH1106_HEIGHT) {
-                    SH1106_SetPixel(buf, pixel_x, pixel_y, true);
-                }
-            }
-        }
+    if (!dev->config.shared_bus) {
+        gpio_set_function(dev->config.sda_pin, GPIO_FUNC_SIO);
+        gpio_set_function(dev->config.scl_pin, GPIO_FUNC_SIO);
+        gpio_set_dir(dev->config.sda_pin, GPIO_OUT);
+        gpio_set_dir(dev->config.scl_pin, GPIO_OUT);
+        gpio_put(dev->config.sda_pin, 0);
+        gpio_put(dev->config.scl_pin, 0);
     }
+
+    dev->initialized = false;
+}
+
+bool sh1106_is_present(sh1106_t *dev) {
+    // Attempt a zero-byte write — ACK means device is present
+    return i2c_write_blocking(dev->config.i2c, dev->config.address, NULL, 0, false) >= 0;
 }
 
-void SH1106_WriteString(uint8_t *buf, int16_t x, int16_t y, char *str) {
-    int current_x = x;
-    
-    while (*str && current_x < SH1106_WIDTH - 8) {
-        SH1106_WriteChar(buf, current_x, y, *str);
-        current_x += 8;  // Move to next character position
-        str++;
+// ============================================================================
+// DISPLAY CONTROL
+// ============================================================================
+
+void sh1106_display_on(sh1106_t *dev, bool on) {
+    send_cmd(dev, SH1106_SET_DISP | (on ? 0x01 : 0x00));
+}
+
+void sh1106_set_contrast(sh1106_t *dev, uint8_t contrast) {
+    uint8_t cmds[] = { SH1106_SET_CONTRAST, contrast };
+    dev->contrast = contrast;
+    send_cmd_list(dev, cmds, count_of(cmds));
+}
+
+void sh1106_scroll(sh1106_t *dev, bool on) {
+    // SH1106 scrolling configuration (similar to SSD1306 but may behave differently)
+    uint8_t cmds[] = {
+        SH1106_SET_HORIZ_SCROLL | 0x00,
+        0x00,                   // dummy byte
+        0x00,                   // start page 0
+        0x00,                   // time interval
+        SH1106_NUM_PAGES - 1,   // end page
+        0x00,                   // dummy byte
+        0xFF,                   // dummy byte
+        SH1106_SET_SCROLL | (on ? 0x01 : 0x00)
+    };
+    send_cmd_list(dev, cmds, count_of(cmds));
+}
+
+// ============================================================================
+// RENDERING
+// ============================================================================
+
+void sh1106_calc_render_area_buflen(sh1106_render_area_t *area) {
+    area->buflen = (area->end_col - area->start_col + 1)
+                 * (area->end_page - area->start_page + 1);
+}
+
+void sh1106_render(sh1106_t *dev, uint8_t *buf, sh1106_render_area_t *area) {
+    // buf holds the area packed row by row; send it one page at a time
+    int width = area->end_col - area->start_col + 1;
+
+    for (int page = area->start_page; page <= area->end_page; page++) {
+        set_page_col(dev, (uint8_t)page, area->start_col);
+        send_buf(dev, buf, width);
+        oled_shadow_store(&dev->gfx, page, area->start_col, buf, width);
+        buf += width;
     }
 }
 
-void SH1106_WriteLines(uint8_t *buf, int16_t x, int16_t y, char **lines, int line_count, int line_spacing) {
-    int current_y = y;
-    
-    for (int i = 0; i < line_count; i++) {
-        if (current_y > SH1106_HEIGHT - 8) break;  // Don't draw outside screen
-        
-        SH1106_WriteString(buf, x, current_y, lines[i]);
-        current_y += line_spacing;
+void sh1106_render_full_screen(sh1106_t *dev, uint8_t *buf) {
+    for (int page = 0; page < SH1106_NUM_PAGES; page++) {
+        set_page_col(dev, (uint8_t)page, 0);
+        send_buf(dev, &buf[page * SH1106_WIDTH], SH1106_WIDTH);
+        oled_shadow_store(&dev->gfx, page, 0, &buf[page * SH1106_WIDTH], SH1106_WIDTH);
     }
+    sh1106_clear_dirty(dev);
 }
 
-void SH1106_WriteCentered(uint8_t *buf, int16_t y, char *str) {
-    int str_len = strlen(str);
-    int str_width = str_len * 8;  // Each character is 8 pixels wide
-    int x = (SH1106_WIDTH - str_width) / 2;
-    
-    if (x < 0) x = 0;  // Don't go negative
-    
-    SH1106_WriteString(buf, x, y, str);
-}
\ No newline at end of file
+void sh1106_render_framebuffer(sh1106_t *dev, sh1106_framebuffer_t *fb) {
+    // A rotated canvas has to go through the transposing flush
+    if (oled_is_transposed(&dev->gfx)) {
+        oled_mark_all_dirty(&dev->gfx);
+        oled_flush(&dev->gfx, fb);
+        return;
+    }
+
+    for (int page = 0; page < SH1106_NUM_PAGES; page++) {
+        set_page_col(dev, (uint8_t)page, 0);
+        send_framebuffer_slice(dev, &fb->data[page * SH1106_WIDTH], SH1106_WIDTH);
+        oled_shadow_store(&dev->gfx, page, 0, &fb->data[page * SH1106_WIDTH], SH1106_WIDTH);
+    }
+    sh1106_clear_dirty(dev);
+}
@@ -1,7 +1,7 @@
 /**
  * @file ssd1306.h
  * @brief SSD1306 OLED display driver
- * @version 3.0
+ * @version 3.1
  *
  * Instance-based driver. All state lives in ssd1306_t.
  * No global variables, no compile-time pin configuration.
@@ -14,19 +14,26 @@
 #include <stdbool.h>
 #include <string.h>
 #include "hardware/i2c.h"
+#include "oled_core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
 
 // ============================================================================
 // DISPLAY PARAMETERS
 // ============================================================================
 
-#define SSD1306_HEIGHT          64
-#define SSD1306_WIDTH           128
-#define SSD1306_PAGE_HEIGHT     8
-#define SSD1306_NUM_PAGES       (SSD1306_HEIGHT / SSD1306_PAGE_HEIGHT)
-#define SSD1306_BUF_LEN         (SSD1306_NUM_PAGES * SSD1306_WIDTH)
+// Largest panel; smaller ones are set in ssd1306_config_t
+#define SSD1306_HEIGHT          OLED_HEIGHT
+#define SSD1306_WIDTH           OLED_WIDTH
+#define SSD1306_PAGE_HEIGHT     OLED_PAGE_HEIGHT
+#define SSD1306_NUM_PAGES       OLED_NUM_PAGES
+#define SSD1306_BUF_LEN         OLED_BUF_LEN
 
 #define SSD1306_DEFAULT_ADDRESS 0x3C
 #define SSD1306_DEFAULT_BAUDRATE 400000
+#define SSD1306_DEFAULT_CONTRAST 0xFF
 
 // ============================================================================
 // COMMANDS
@@ -36,12 +43,14 @@
 #define SSD1306_SET_COL_ADDR        0x21
 #define SSD1306_SET_PAGE_ADDR       0x22
 #define SSD1306_SET_HORIZ_SCROLL    0x26
+#define SSD1306_SET_DIAG_SCROLL     0x29
 #define SSD1306_SET_SCROLL          0x2E
 #define SSD1306_SET_DISP_START_LINE 0x40
 #define SSD1306_SET_CONTRAST        0x81
 #define SSD1306_SET_CHARGE_PUMP     0x8D
 #define SSD1306_SET_SEG_REMAP       0xA0
 #define SSD1306_SET_ENTIRE_ON       0xA4
+#define SSD1306_SET_VERT_SCROLL_AREA 0xA3
 #define SSD1306_SET_NORM_DISP       0xA6
 #define SSD1306_SET_MUX_RATIO       0xA8
 #define SSD1306_SET_DISP            0xAE
@@ -64,6 +73,7 @@ typedef struct {
     int     buflen;
 } ssd1306_render_area_t;
 
+// Whole 128x64 panel; smaller panels describe their own area
 #define SSD1306_FULL_SCREEN_AREA() ((ssd1306_render_area_t){ \
     .start_col  = 0,                    \
     .end_col    = SSD1306_WIDTH - 1,    \
@@ -79,6 +89,34 @@ typedef struct {
 #define SSD1306_CLEAR_BUFFER(buf) memset(buf, 0x00, SSD1306_BUF_LEN)
 #define SSD1306_FILL_BUFFER(buf)  memset(buf, 0xFF, SSD1306_BUF_LEN)
 
+// ============================================================================
+// SCROLLING
+// ============================================================================
+
+typedef enum {
+    SSD1306_SCROLL_RIGHT = 0,
+    SSD1306_SCROLL_LEFT  = 1,       // Added to the scroll opcode
+} ssd1306_scroll_dir_t;
+
+// Frames between scroll steps, in the controller's encoding
+typedef enum {
+    SSD1306_SCROLL_2_FRAMES   = 0x07,
+    SSD1306_SCROLL_3_FRAMES   = 0x04,
+    SSD1306_SCROLL_4_FRAMES   = 0x05,
+    SSD1306_SCROLL_5_FRAMES   = 0x00,
+    SSD1306_SCROLL_25_FRAMES  = 0x06,
+    SSD1306_SCROLL_64_FRAMES  = 0x01,
+    SSD1306_SCROLL_128_FRAMES = 0x02,
+    SSD1306_SCROLL_256_FRAMES = 0x03,
+} ssd1306_scroll_speed_t;
+
+// ============================================================================
+// FRAMEBUFFER
+// ============================================================================
+
+// Zero-copy framebuffer, see oled_framebuffer_t. Draw into fb.data.
+typedef oled_framebuffer_t ssd1306_framebuffer_t;
+
 // ============================================================================
 // CONFIG AND DEVICE STRUCTS
 // ============================================================================
@@ -89,11 +127,47 @@ typedef struct {
     uint8_t     scl_pin;
     uint8_t     address;
     uint32_t    baudrate;
+    bool        shared_bus;     // Bus set up elsewhere (e.g. oled_bus): leave it alone
+    uint8_t     width;          // Panel size, e.g. 128x64, 128x32, 72x40; 0 means 128x64
+    uint8_t     height;
 } ssd1306_config_t;
 
+// Called from ssd1306_render_async_poll() when a transfer finishes.
+// ok is false if the panel NAKed and the transfer was aborted.
+typedef void (*ssd1306_async_callback_t)(void *user_data, bool ok);
+
 typedef struct {
-    ssd1306_config_t config;
-    bool             initialized;
+    int                      dma_channel;   // -1 until the first async render
+    const uint8_t           *src;           // Framebuffer data being sent
+    uint8_t                  start_page;
+    uint8_t                  end_page;
+    uint8_t                  next_page;     // Next page to stage for DMA
+    ssd1306_async_callback_t callback;
+    void                    *user_data;
+
+    // DATA_CMD words for one page (+ control byte). The RP2040 I2C block
+    // needs 16-bit writes so the STOP bit can ride on the last byte, which
+    // rules out pointing DMA straight at the 8-bit framebuffer.
+    uint16_t                 words[SSD1306_WIDTH + 1];
+} ssd1306_async_t;
+
+// Log console: each line is one page of panel RAM. Once the screen is full
+// the start line moves down a page, so the oldest line's page becomes the
+// bottom row and is overwritten - one page write per line, no redraw.
+typedef struct {
+    const oled_font_t *font;        // At most one page tall
+    uint8_t            next_page;   // RAM page the next line goes to
+    uint8_t            lines;       // Lines on screen, up to SSD1306_NUM_PAGES
+} ssd1306_console_t;
+
+typedef struct {
+    ssd1306_config_t  config;
+    bool              initialized;
+    uint8_t           start_line;   // RAM row shown at the top of the screen
+    uint8_t           contrast;     // Re-sent by the init sequence
+    ssd1306_async_t   async;
+    ssd1306_console_t console;
+    oled_t            gfx;          // Dirty tracking and busy flag (oled_core)
 } ssd1306_t;
 
 // ============================================================================
@@ -103,11 +177,14 @@ typedef struct {
 static inline ssd1306_config_t ssd1306_create_config(
         i2c_inst_t *i2c, uint8_t sda_pin, uint8_t scl_pin) {
     ssd1306_config_t cfg = {
-        .i2c      = i2c,
-        .sda_pin  = sda_pin,
-        .scl_pin  = scl_pin,
-        .address  = SSD1306_DEFAULT_ADDRESS,
-        .baudrate = SSD1306_DEFAULT_BAUDRATE
+        .i2c        = i2c,
+        .sda_pin    = sda_pin,
+        .scl_pin    = scl_pin,
+        .address    = SSD1306_DEFAULT_ADDRESS,
+        .baudrate   = SSD1306_DEFAULT_BAUDRATE,
+        .shared_bus = false,
+        .width      = SSD1306_WIDTH,
+        .height     = SSD1306_HEIGHT
     };
     return cfg;
 }
@@ -122,18 +199,139 @@ void ssd1306_deinit(ssd1306_t *dev);
 bool ssd1306_is_present(ssd1306_t *dev);
 
 // Display control
+// Contrast is the segment drive current, 0x00-0xFF; it is kept across
+// oled_reinit() so a rail cut does not bring the panel back at full brightness
 void ssd1306_display_on(ssd1306_t *dev, bool on);
+void ssd1306_set_contrast(ssd1306_t *dev, uint8_t contrast);
+
+// Hardware scrolling
+// The controller shifts panel RAM itself while a scroll runs, so stop it
+// before writing new frames. ssd1306_scroll_stop() marks the whole screen
+// dirty so the next flush restores what scrolling moved.
+// ssd1306_scroll() is the classic full-screen right scroll on/off.
 void ssd1306_scroll(ssd1306_t *dev, bool on);
+void ssd1306_scroll_horizontal(ssd1306_t *dev, ssd1306_scroll_dir_t dir,
+                               uint8_t start_page, uint8_t end_page,
+                               ssd1306_scroll_speed_t speed);
+// Horizontal scroll of pages start..end plus a vertical shift of
+// rows_per_step each step, within the band of scroll_rows rows that starts
+// below fixed_rows.
+void ssd1306_scroll_diagonal(ssd1306_t *dev, ssd1306_scroll_dir_t dir,
+                             uint8_t start_page, uint8_t end_page,
+                             ssd1306_scroll_speed_t speed, uint8_t rows_per_step,
+                             uint8_t fixed_rows, uint8_t scroll_rows);
+void ssd1306_scroll_stop(ssd1306_t *dev);
+
+// Rotation (clockwise). 180 uses the controller's remap bits; at 90/270 the
+// canvas is 64x128 (dev->gfx.width x height) and is transposed on flush.
+// Redraw the buffer after switching between landscape and portrait.
+static inline bool ssd1306_set_rotation(ssd1306_t *dev, oled_rotation_t rotation) {
+    return oled_set_rotation(&dev->gfx, rotation);
+}
+
+// Vertical offset: RAM row `line` (0-63) is shown at the top, wrapping.
+// Takes effect immediately and leaves RAM alone, so it is free to animate.
+// The RAM always has 64 rows; a shorter panel shows the next panel-height
+// rows after `line`, which may lie outside the pages its buffer covers.
+void ssd1306_set_start_line(ssd1306_t *dev, uint8_t line);
+
+// Log console
+// begin clears fb and the screen; print appends a line (clipped, not
+// wrapped) and sends only its page; end returns to start line 0 and marks
+// everything dirty - fb is still rotated, so redraw it before flushing.
+// font NULL means the 8x8 font. Needs a 64-row panel at rotation 0 or 180:
+// begin returns false otherwise, and print and end then do nothing.
+bool ssd1306_console_begin(ssd1306_t *dev, ssd1306_framebuffer_t *fb, const oled_font_t *font);
+void ssd1306_console_print(ssd1306_t *dev, ssd1306_framebuffer_t *fb, const char *line);
+void ssd1306_console_end(ssd1306_t *dev);
 
 // Rendering
 void ssd1306_calc_render_area_buflen(ssd1306_render_area_t *area);
 void ssd1306_render(ssd1306_t *dev, uint8_t *buf, ssd1306_render_area_t *area);
+void ssd1306_render_framebuffer(ssd1306_t *dev, ssd1306_framebuffer_t *fb);
 
-// Graphics
-void ssd1306_set_pixel(ssd1306_t *dev, uint8_t *buf, int x, int y, bool on);
-void ssd1306_draw_line(ssd1306_t *dev, uint8_t *buf, int x0, int y0, int x1, int y1, bool on);
-void ssd1306_write_char(ssd1306_t *dev, uint8_t *buf, int16_t x, int16_t y, uint8_t ch);
-void ssd1306_write_string(ssd1306_t *dev, uint8_t *buf, int16_t x, int16_t y, const char *str);
-void ssd1306_write_centered(ssd1306_t *dev, uint8_t *buf, int16_t y, const char *str);
+// Dirty tracking
+// Graphics calls mark what they touch. Code that writes the buffer directly
+// (e.g. SSD1306_CLEAR_BUFFER) must call ssd1306_mark_dirty/mark_all_dirty.
+static inline void ssd1306_mark_dirty(ssd1306_t *dev, int x0, int y0, int x1, int y1) {
+    oled_mark_dirty(&dev->gfx, x0, y0, x1, y1);
+}
+static inline void ssd1306_mark_all_dirty(ssd1306_t *dev) { oled_mark_all_dirty(&dev->gfx); }
+static inline void ssd1306_clear_dirty(ssd1306_t *dev) { oled_clear_dirty(&dev->gfx); }
+static inline bool ssd1306_is_dirty(const ssd1306_t *dev) { return oled_is_dirty(&dev->gfx); }
+static inline void ssd1306_flush(ssd1306_t *dev, ssd1306_framebuffer_t *fb) { oled_flush(&dev->gfx, fb); }
+
+// Shadow frame
+// With a shadow attached, flushes send only bytes that differ from what the
+// panel already shows - useful when every frame is cleared and redrawn.
+static inline void ssd1306_set_shadow(ssd1306_t *dev, oled_shadow_t *shadow) {
+    oled_set_shadow(&dev->gfx, shadow);
+}
+
+// Asynchronous rendering (DMA)
+// Sends the dirty pages of fb as one I2C transaction, fed page by page from
+// ssd1306_render_async_poll(). While busy the bus belongs to this transfer:
+// driver calls on dev wait for it, but other devices on the same bus and
+// direct writes to fb (e.g. SSD1306_CLEAR_BUFFER) must wait for completion.
+// The transfer only advances when the caller polls: DMA moves one page, and
+// the next is staged by the next poll. In between, the I2C block holds SCL
+// low with the transaction still open, so a slow poll loop stretches the
+// render and stalls every other device on the bus for as long.
+bool ssd1306_render_async(ssd1306_t *dev, ssd1306_framebuffer_t *fb,
+                          ssd1306_async_callback_t callback, void *user_data);
+bool ssd1306_render_async_poll(ssd1306_t *dev);
+void ssd1306_render_async_wait(ssd1306_t *dev);
+static inline bool ssd1306_is_busy(const ssd1306_t *dev) { return dev->gfx.busy; }
+
+// Graphics and text
+// Thin wrappers over oled_core; every oled_* drawing call can also be used
+// directly on &dev->gfx.
+static inline void ssd1306_set_pixel(ssd1306_t *dev, uint8_t *buf, int x, int y, bool on) {
+    oled_set_pixel(&dev->gfx, buf, x, y, on);
+}
+static inline void ssd1306_draw_line(ssd1306_t *dev, uint8_t *buf, int x0, int y0, int x1, int y1, bool on) {
+    oled_draw_line(&dev->gfx, buf, x0, y0, x1, y1, on);
+}
+static inline void ssd1306_draw_hline(ssd1306_t *dev, uint8_t *buf, int x, int y, int w, bool on) {
+    oled_draw_hline(&dev->gfx, buf, x, y, w, on);
+}
+static inline void ssd1306_draw_vline(ssd1306_t *dev, uint8_t *buf, int x, int y, int h, bool on) {
+    oled_draw_vline(&dev->gfx, buf, x, y, h, on);
+}
+static inline void ssd1306_draw_rect(ssd1306_t *dev, uint8_t *buf, int x, int y, int w, int h, bool on) {
+    oled_draw_rect(&dev->gfx, buf, x, y, w, h, on);
+}
+static inline void ssd1306_fill_rect(ssd1306_t *dev, uint8_t *buf, int x, int y, int w, int h, bool on) {
+    oled_fill_rect(&dev->gfx, buf, x, y, w, h, on);
+}
+static inline void ssd1306_clear_area(ssd1306_t *dev, uint8_t *buf, int x, int y, int w, int h) {
+    oled_clear_area(&dev->gfx, buf, x, y, w, h);
+}
+static inline void ssd1306_blit(ssd1306_t *dev, uint8_t *buf, int x, int y, const oled_bitmap_t *bmp, oled_rop_t rop) {
+    oled_blit(&dev->gfx, buf, x, y, bmp, rop);
+}
+static inline void ssd1306_draw_label(ssd1306_t *dev, uint8_t *buf, int x, int y, const oled_label_t *label) {
+    oled_draw_label(&dev->gfx, buf, x, y, label);
+}
+static inline void ssd1306_write_char(ssd1306_t *dev, uint8_t *buf, int16_t x, int16_t y, uint8_t ch) {
+    oled_write_char(&dev->gfx, buf, x, y, ch);
+}
+static inline void ssd1306_write_string(ssd1306_t *dev, uint8_t *buf, int16_t x, int16_t y, const char *str) {
+    oled_write_string(&dev->gfx, buf, x, y, str);
+}
+static inline void ssd1306_write_centered(ssd1306_t *dev, uint8_t *buf, int16_t y, const char *str) {
+    oled_write_centered(&dev->gfx, buf, y, str);
+}
+static inline void ssd1306_write_int(ssd1306_t *dev, uint8_t *buf, int16_t x, int16_t y, int32_t value, uint8_t width) {
+    oled_write_int(&dev->gfx, buf, x, y, value, width);
+}
+static inline void ssd1306_write_fixed(ssd1306_t *dev, uint8_t *buf, int16_t x, int16_t y,
+                                       int32_t value, uint8_t decimals, uint8_t width) {
+    oled_write_fixed(&dev->gfx, buf, x, y, value, decimals, width);
+}
+
+#ifdef __cplusplus
+}
+#endif
 
 #endif // SSD1306_H
\ No newline at end of file
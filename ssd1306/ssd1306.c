@@ -1,29 +1,54 @@
 /**
  * @file ssd1306.c
  * @brief SSD1306 OLED display driver implementation
- * @version 3.0
+ * @version 3.1
  */
 
 #include "ssd1306.h"
-#include "ssd1306_font.h"
 #include "hardware/gpio.h"
+#include "hardware/dma.h"
 #include "pico/stdlib.h"
-#include <stdlib.h>
 #include <string.h>
-#include <ctype.h>
 
 // ============================================================================
 // INTERNAL: LOW-LEVEL I2C
 // ============================================================================
 
+// Any blocking transfer has to wait for an in-flight async render first,
+// both for bus ownership and so the framebuffer is not modified under DMA.
+static inline void wait_idle(ssd1306_t *dev) {
+    if (dev->gfx.busy) ssd1306_render_async_wait(dev);
+}
+
+// Pages of the panel as configured, up to SSD1306_NUM_PAGES
+static inline int num_pages(const ssd1306_t *dev) {
+    return dev->gfx.panel_height / SSD1306_PAGE_HEIGHT;
+}
+
 static void send_cmd(ssd1306_t *dev, uint8_t cmd) {
+    wait_idle(dev);
     uint8_t buf[2] = {0x80, cmd};
     i2c_write_blocking(dev->config.i2c, dev->config.address, buf, 2, false);
 }
 
+// Command bytes sent behind one control byte; longer lists are split across
+// transactions. Big enough for the whole init sequence to go out at once.
+#define CMD_STREAM_MAX 32
+
 static void send_cmd_list(ssd1306_t *dev, uint8_t *cmds, int count) {
-    for (int i = 0; i < count; i++) {
-        send_cmd(dev, cmds[i]);
+    // Co = 0, D/C = 0: every following byte in this transaction is a command,
+    // so the whole list goes out behind a single control byte.
+    uint8_t tmp[CMD_STREAM_MAX + 1];
+    tmp[0] = 0x00;
+
+    wait_idle(dev);
+
+    while (count > 0) {
+        int n = count > CMD_STREAM_MAX ? CMD_STREAM_MAX : count;
+        memcpy(tmp + 1, cmds, n);
+        i2c_write_blocking(dev->config.i2c, dev->config.address, tmp, n + 1, false);
+        cmds  += n;
+        count -= n;
     }
 }
 
@@ -32,43 +57,59 @@ static void send_buf(ssd1306_t *dev, uint8_t *buf, int buflen) {
     // SSD1306_BUF_LEN + 1 is the worst case; render areas are always <= that.
     uint8_t tmp[SSD1306_BUF_LEN + 1];
     tmp[0] = 0x40;
+    wait_idle(dev);
     memcpy(tmp + 1, buf, buflen);
     i2c_write_blocking(dev->config.i2c, dev->config.address, tmp, buflen + 1, false);
 }
 
-// ============================================================================
-// INITIALIZATION
-// ============================================================================
-
-bool ssd1306_init(ssd1306_t *dev, const ssd1306_config_t *config) {
-    if (!dev || !config) return false;
+static void send_framebuffer_slice(ssd1306_t *dev, uint8_t *data, int len) {
+    // data points into ssd1306_framebuffer_t, so data[-1] is always valid
+    // (fb->control for the first byte, otherwise the previous pixel byte).
+    // Borrow it for the control byte and put the pixels back afterwards.
+    wait_idle(dev);
+    uint8_t saved = data[-1];
+    data[-1] = 0x40;
+    i2c_write_blocking(dev->config.i2c, dev->config.address, data - 1, len + 1, false);
+    data[-1] = saved;
+}
 
-    dev->config      = *config;
-    dev->initialized = false;
+static void set_window(ssd1306_t *dev, uint8_t start_col, uint8_t end_col,
+                       uint8_t start_page, uint8_t end_page) {
+    // Narrower panels show the middle of the 128-column RAM
+    uint8_t offset = (uint8_t)((SSD1306_WIDTH - dev->gfx.panel_width) / 2);
+    start_col += offset;
+    end_col   += offset;
 
-    i2c_init(dev->config.i2c, dev->config.baudrate);
-    gpio_set_function(dev->config.sda_pin, GPIO_FUNC_I2C);
-    gpio_set_function(dev->config.scl_pin, GPIO_FUNC_I2C);
-    gpio_pull_up(dev->config.sda_pin);
-    gpio_pull_up(dev->config.scl_pin);
+    uint8_t cmds[] = {
+        SSD1306_SET_COL_ADDR,  start_col,  end_col,
+        SSD1306_SET_PAGE_ADDR, start_page, end_page
+    };
+    send_cmd_list(dev, cmds, sizeof(cmds));
+}
 
-    sleep_ms(10);
+// ============================================================================
+// INTERNAL: OLED_CORE BACKEND
+// ============================================================================
 
+static bool send_init_sequence(ssd1306_t *dev) {
     if (!ssd1306_is_present(dev)) return false;
 
+    // 128x32 modules wire the COM lines sequentially, taller ones alternate
+    uint8_t com_pins = dev->gfx.panel_height == 32 ? 0x02 : 0x12;
+
     uint8_t cmds[] = {
         SSD1306_SET_DISP,
         SSD1306_SET_MEM_MODE,           0x00,
-        SSD1306_SET_DISP_START_LINE,
+        SSD1306_SET_DISP_START_LINE | dev->start_line,
         SSD1306_SET_SEG_REMAP | 0x01,
-        SSD1306_SET_MUX_RATIO,          SSD1306_HEIGHT - 1,
+        SSD1306_SET_MUX_RATIO,          dev->gfx.panel_height - 1,
         SSD1306_SET_COM_OUT_DIR | 0x08,
         SSD1306_SET_DISP_OFFSET,        0x00,
-        SSD1306_SET_COM_PIN_CFG,        0x12,
+        SSD1306_SET_COM_PIN_CFG,        com_pins,
         SSD1306_SET_DISP_CLK_DIV,       0x80,
         SSD1306_SET_PRECHARGE,          0xF1,
         SSD1306_SET_VCOM_DESEL,         0x30,
-        SSD1306_SET_CONTRAST,           0xFF,
+        SSD1306_SET_CONTRAST,           dev->contrast,
         SSD1306_SET_ENTIRE_ON,
         SSD1306_SET_NORM_DISP,
         SSD1306_SET_CHARGE_PUMP,        0x14,
@@ -77,6 +118,87 @@ bool ssd1306_init(ssd1306_t *dev, const ssd1306_config_t *config) {
     };
 
     send_cmd_list(dev, cmds, sizeof(cmds));
+    return true;
+}
+
+static bool backend_init(void *ctx) {
+    return send_init_sequence((ssd1306_t *)ctx);
+}
+
+static void backend_set_window(void *ctx, uint8_t page, uint8_t start_col, uint8_t end_col) {
+    set_window((ssd1306_t *)ctx, start_col, end_col, page, page);
+}
+
+static void backend_send_data(void *ctx, uint8_t *data, int len) {
+    send_framebuffer_slice((ssd1306_t *)ctx, data, len);
+}
+
+static void backend_wait_idle(void *ctx) {
+    ssd1306_render_async_wait((ssd1306_t *)ctx);
+}
+
+static void backend_set_flip(void *ctx, bool flip_x, bool flip_y) {
+    // Init sets column 127 -> SEG0 and COM63 first; flipping undoes either
+    uint8_t cmds[] = {
+        SSD1306_SET_SEG_REMAP   | (flip_x ? 0x00 : 0x01),
+        SSD1306_SET_COM_OUT_DIR | (flip_y ? 0x00 : 0x08),
+    };
+    send_cmd_list((ssd1306_t *)ctx, cmds, sizeof(cmds));
+}
+
+static void backend_set_contrast(void *ctx, uint8_t contrast) {
+    ssd1306_set_contrast((ssd1306_t *)ctx, contrast);
+}
+
+static void backend_set_display_on(void *ctx, bool on) {
+    ssd1306_display_on((ssd1306_t *)ctx, on);
+}
+
+static const oled_backend_t ssd1306_backend = {
+    .init           = backend_init,
+    .set_window     = backend_set_window,
+    .send_data      = backend_send_data,
+    .wait_idle      = backend_wait_idle,
+    .set_flip       = backend_set_flip,
+    .set_contrast   = backend_set_contrast,
+    .set_display_on = backend_set_display_on,
+};
+
+// ============================================================================
+// INITIALIZATION
+// ============================================================================
+
+bool ssd1306_init(ssd1306_t *dev, const ssd1306_config_t *config) {
+    if (!dev || !config) return false;
+
+    dev->config      = *config;
+    dev->initialized = false;
+    dev->start_line  = 0;
+    dev->contrast    = SSD1306_DEFAULT_CONTRAST;
+    memset(&dev->console, 0, sizeof(dev->console));
+    memset(&dev->async, 0, sizeof(dev->async));
+    dev->async.dma_channel = -1;
+
+    oled_bind(&dev->gfx, &ssd1306_backend, dev);
+
+    // Configs built by hand before width/height existed mean 128x64
+    if (!dev->config.width)  dev->config.width  = SSD1306_WIDTH;
+    if (!dev->config.height) dev->config.height = SSD1306_HEIGHT;
+    if (!oled_set_geometry(&dev->gfx, dev->config.width, dev->config.height)) return false;
+
+    // On a shared bus the owner has set up the I2C block and pins once;
+    // i2c_init() here would reset them under the other devices
+    if (!dev->config.shared_bus) {
+        i2c_init(dev->config.i2c, dev->config.baudrate);
+        gpio_set_function(dev->config.sda_pin, GPIO_FUNC_I2C);
+        gpio_set_function(dev->config.scl_pin, GPIO_FUNC_I2C);
+        gpio_pull_up(dev->config.sda_pin);
+        gpio_pull_up(dev->config.scl_pin);
+    }
+
+    sleep_ms(10);
+
+    if (!send_init_sequence(dev)) return false;
 
     dev->initialized = true;
     return true;
@@ -87,17 +209,25 @@ void ssd1306_deinit(ssd1306_t *dev) {
 
     send_cmd(dev, SSD1306_SET_DISP);    // Display off
 
-    gpio_set_function(dev->config.sda_pin, GPIO_FUNC_SIO);
-    gpio_set_function(dev->config.scl_pin, GPIO_FUNC_SIO);
-    gpio_set_dir(dev->config.sda_pin, GPIO_OUT);
-    gpio_set_dir(dev->config.scl_pin, GPIO_OUT);
-    gpio_put(dev->config.sda_pin, 0);
-    gpio_put(dev->config.scl_pin, 0);
+    if (dev->async.dma_channel >= 0) {
+        dma_channel_unclaim(dev->async.dma_channel);
+        dev->async.dma_channel = -1;
+    }
+
+    if (!dev->config.shared_bus) {
+        gpio_set_function(dev->config.sda_pin, GPIO_FUNC_SIO);
+        gpio_set_function(dev->config.scl_pin, GPIO_FUNC_SIO);
+        gpio_set_dir(dev->config.sda_pin, GPIO_OUT);
+        gpio_set_dir(dev->config.scl_pin, GPIO_OUT);
+        gpio_put(dev->config.sda_pin, 0);
+        gpio_put(dev->config.scl_pin, 0);
+    }
 
     dev->initialized = false;
 }
 
 bool ssd1306_is_present(ssd1306_t *dev) {
+    wait_idle(dev);
     // Attempt a zero-byte write — ACK means device is present
     return i2c_write_blocking(dev->config.i2c, dev->config.address, NULL, 0, false) >= 0;
 }
@@ -110,20 +240,131 @@ void ssd1306_display_on(ssd1306_t *dev, bool on) {
     send_cmd(dev, SSD1306_SET_DISP | (on ? 0x01 : 0x00));
 }
 
+void ssd1306_set_contrast(ssd1306_t *dev, uint8_t contrast) {
+    uint8_t cmds[] = { SSD1306_SET_CONTRAST, contrast };
+    dev->contrast = contrast;
+    send_cmd_list(dev, cmds, sizeof(cmds));
+}
+
+// ============================================================================
+// SCROLLING
+// ============================================================================
+
 void ssd1306_scroll(ssd1306_t *dev, bool on) {
+    if (on)
+        ssd1306_scroll_horizontal(dev, SSD1306_SCROLL_RIGHT, 0, num_pages(dev) - 1,
+                                  SSD1306_SCROLL_5_FRAMES);
+    else
+        ssd1306_scroll_stop(dev);
+}
+
+void ssd1306_scroll_horizontal(ssd1306_t *dev, ssd1306_scroll_dir_t dir,
+                               uint8_t start_page, uint8_t end_page,
+                               ssd1306_scroll_speed_t speed) {
+    // Scroll setup is only accepted while scrolling is off
     uint8_t cmds[] = {
-        SSD1306_SET_HORIZ_SCROLL | 0x00,
-        0x00,
-        0x00,
+        SSD1306_SET_SCROLL | 0x00,
+        SSD1306_SET_HORIZ_SCROLL + dir,
         0x00,
-        SSD1306_NUM_PAGES - 1,
+        start_page & 0x07,
+        speed,
+        end_page & 0x07,
         0x00,
         0xFF,
-        SSD1306_SET_SCROLL | (on ? 0x01 : 0x00)
+        SSD1306_SET_SCROLL | 0x01
+    };
+    send_cmd_list(dev, cmds, sizeof(cmds));
+}
+
+void ssd1306_scroll_diagonal(ssd1306_t *dev, ssd1306_scroll_dir_t dir,
+                             uint8_t start_page, uint8_t end_page,
+                             ssd1306_scroll_speed_t speed, uint8_t rows_per_step,
+                             uint8_t fixed_rows, uint8_t scroll_rows) {
+    // The band must fit the panel and the step must be smaller than the band
+    uint8_t height = dev->gfx.panel_height;
+    if (fixed_rows >= height) fixed_rows = height - 1;
+    if (scroll_rows > height - fixed_rows) scroll_rows = height - fixed_rows;
+    if (scroll_rows == 0) scroll_rows = 1;
+    if (rows_per_step >= scroll_rows) rows_per_step = scroll_rows - 1;
+
+    uint8_t cmds[] = {
+        SSD1306_SET_SCROLL | 0x00,
+        SSD1306_SET_VERT_SCROLL_AREA,   fixed_rows, scroll_rows,
+        SSD1306_SET_DIAG_SCROLL + dir,
+        0x00,
+        start_page & 0x07,
+        speed,
+        end_page & 0x07,
+        rows_per_step,
+        SSD1306_SET_SCROLL | 0x01
     };
     send_cmd_list(dev, cmds, sizeof(cmds));
 }
 
+void ssd1306_scroll_stop(ssd1306_t *dev) {
+    send_cmd(dev, SSD1306_SET_SCROLL | 0x00);
+
+    // Scrolling moved RAM contents; the next flush puts the frame back
+    oled_shadow_invalidate(&dev->gfx);
+}
+
+void ssd1306_set_start_line(ssd1306_t *dev, uint8_t line) {
+    // Indexes the 64-row GDDRAM whatever the panel height
+    dev->start_line = line % SSD1306_HEIGHT;
+    send_cmd(dev, SSD1306_SET_DISP_START_LINE | dev->start_line);
+}
+
+// ============================================================================
+// LOG CONSOLE
+// ============================================================================
+
+bool ssd1306_console_begin(ssd1306_t *dev, ssd1306_framebuffer_t *fb, const oled_font_t *font) {
+    // Scrolling by start line cycles through all 8 RAM pages, but a shorter
+    // panel's buffer covers only the pages it shows
+    if (dev->gfx.panel_height != SSD1306_HEIGHT || oled_is_transposed(&dev->gfx)) return false;
+
+    dev->console.font      = font ? font : &oled_font_8x8;
+    dev->console.next_page = 0;
+    dev->console.lines     = 0;
+
+    ssd1306_set_start_line(dev, 0);
+    SSD1306_CLEAR_BUFFER(fb->data);
+    oled_mark_all_dirty(&dev->gfx);
+    oled_flush(&dev->gfx, fb);
+    return true;
+}
+
+void ssd1306_console_print(ssd1306_t *dev, ssd1306_framebuffer_t *fb, const char *line) {
+    uint8_t page = dev->console.next_page;
+    int     y    = page * SSD1306_PAGE_HEIGHT;
+
+    if (!dev->console.font) return;     // Not begun, or refused
+
+    // Screen full: page is the oldest line. Moving the start line to the
+    // page after it turns it into the bottom row before it is rewritten.
+    if (dev->console.lines == num_pages(dev))
+        ssd1306_set_start_line(dev, ((page + 1) % num_pages(dev)) * SSD1306_PAGE_HEIGHT);
+    else
+        dev->console.lines++;
+
+    oled_clear_area(&dev->gfx, fb->data, 0, y, dev->gfx.width, SSD1306_PAGE_HEIGHT);
+    oled_draw_text(&dev->gfx, fb->data, 0, y, dev->console.font, line);
+    oled_flush(&dev->gfx, fb);
+
+    dev->console.next_page = (page + 1) % num_pages(dev);
+}
+
+void ssd1306_console_end(ssd1306_t *dev) {
+    if (!dev->console.font) return;
+
+    dev->console.font      = NULL;
+    dev->console.next_page = 0;
+    dev->console.lines     = 0;
+
+    ssd1306_set_start_line(dev, 0);
+    oled_mark_all_dirty(&dev->gfx);
+}
+
 // ============================================================================
 // RENDERING
 // ============================================================================
@@ -134,68 +375,142 @@ void ssd1306_calc_render_area_buflen(ssd1306_render_area_t *area) {
 }
 
 void ssd1306_render(ssd1306_t *dev, uint8_t *buf, ssd1306_render_area_t *area) {
-    uint8_t cmds[] = {
-        SSD1306_SET_COL_ADDR,  area->start_col,  area->end_col,
-        SSD1306_SET_PAGE_ADDR, area->start_page, area->end_page
-    };
-    send_cmd_list(dev, cmds, sizeof(cmds));
+    set_window(dev, area->start_col, area->end_col, area->start_page, area->end_page);
     send_buf(dev, buf, area->buflen);
+
+    int width = area->end_col - area->start_col + 1;
+    for (int page = area->start_page; page <= area->end_page; page++) {
+        oled_shadow_store(&dev->gfx, page, area->start_col, buf, width);
+        buf += width;
+    }
+}
+
+void ssd1306_render_framebuffer(ssd1306_t *dev, ssd1306_framebuffer_t *fb) {
+    // A rotated canvas has to go through the transposing flush
+    if (oled_is_transposed(&dev->gfx)) {
+        oled_mark_all_dirty(&dev->gfx);
+        oled_flush(&dev->gfx, fb);
+        return;
+    }
+
+    int width = dev->gfx.panel_width;
+    set_window(dev, 0, width - 1, 0, num_pages(dev) - 1);
+    send_framebuffer_slice(dev, fb->data, width * num_pages(dev));
+    for (int page = 0; page < num_pages(dev); page++) {
+        oled_shadow_store(&dev->gfx, page, 0, &fb->data[page * width], width);
+    }
+    ssd1306_clear_dirty(dev);
 }
 
 // ============================================================================
-// GRAPHICS
+// ASYNCHRONOUS RENDERING
 // ============================================================================
 
-void ssd1306_set_pixel(ssd1306_t *dev, uint8_t *buf, int x, int y, bool on) {
-    (void)dev;
-    if (x < 0 || x >= SSD1306_WIDTH || y < 0 || y >= SSD1306_HEIGHT) return;
-
-    int idx = (y / 8) * SSD1306_WIDTH + x;
-    if (on)
-        buf[idx] |=  (1 << (y % 8));
-    else
-        buf[idx] &= ~(1 << (y % 8));
+static void async_stage_next_page(ssd1306_t *dev) {
+    ssd1306_async_t *a = &dev->async;
+    uint8_t scratch[SSD1306_WIDTH];
+    const uint8_t *src = oled_panel_page(&dev->gfx, a->src, a->next_page, scratch);
+    int width = dev->gfx.panel_width;
+    int n = 0;
+
+    oled_shadow_store(&dev->gfx, a->next_page, 0, src, width);
+
+    // Control byte opens the transaction, STOP closes it after the last page;
+    // everything in between streams as a single write.
+    if (a->next_page == a->start_page) a->words[n++] = 0x40;
+    for (int col = 0; col < width; col++) a->words[n++] = src[col];
+    if (a->next_page == a->end_page) a->words[n - 1] |= I2C_IC_DATA_CMD_STOP_BITS;
+
+    dma_channel_config c = dma_channel_get_default_config(a->dma_channel);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, i2c_get_dreq(dev->config.i2c, true));
+    dma_channel_configure(a->dma_channel, &c, &i2c_get_hw(dev->config.i2c)->data_cmd,
+                          a->words, n, true);
+    a->next_page++;
 }
 
-void ssd1306_draw_line(ssd1306_t *dev, uint8_t *buf, int x0, int y0, int x1, int y1, bool on) {
-    int dx =  abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
-    int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
-    int err = dx + dy;
+bool ssd1306_render_async(ssd1306_t *dev, ssd1306_framebuffer_t *fb,
+                          ssd1306_async_callback_t callback, void *user_data) {
+    ssd1306_async_t *a = &dev->async;
+    if (dev->gfx.busy) return false;
+
+    // Full-width pages are contiguous in panel RAM, so the dirty region is
+    // widened to whole pages: one window, one transfer.
+    uint8_t start[SSD1306_NUM_PAGES], end[SSD1306_NUM_PAGES];
+    oled_panel_dirty(&dev->gfx, start, end);
+
+    int first = -1, last = -1;
+    for (int page = 0; page < num_pages(dev); page++) {
+        if (start[page] > end[page]) continue;
+        if (first < 0) first = page;
+        last = page;
+    }
+    if (first < 0) return false;
 
-    while (true) {
-        ssd1306_set_pixel(dev, buf, x0, y0, on);
-        if (x0 == x1 && y0 == y1) break;
-        int e2 = 2 * err;
-        if (e2 >= dy) { err += dy; x0 += sx; }
-        if (e2 <= dx) { err += dx; y0 += sy; }
+    if (a->dma_channel < 0) {
+        a->dma_channel = dma_claim_unused_channel(false);
+        if (a->dma_channel < 0) return false;
     }
+
+    // Also leaves the controller's target address pointing at this panel
+    set_window(dev, 0, dev->gfx.panel_width - 1, (uint8_t)first, (uint8_t)last);
+
+    a->src        = fb->data;
+    a->start_page = (uint8_t)first;
+    a->end_page   = (uint8_t)last;
+    a->next_page  = (uint8_t)first;
+    a->callback   = callback;
+    a->user_data  = user_data;
+    dev->gfx.busy = true;
+
+    ssd1306_clear_dirty(dev);
+    async_stage_next_page(dev);
+    return true;
 }
 
-void ssd1306_write_char(ssd1306_t *dev, uint8_t *buf, int16_t x, int16_t y, uint8_t ch) {
-    if (x < 0 || x > SSD1306_WIDTH - 8 || y < 0 || y > SSD1306_HEIGHT - 8) return;
+bool ssd1306_render_async_poll(ssd1306_t *dev) {
+    ssd1306_async_t *a = &dev->async;
+    if (!dev->gfx.busy) return false;
+    if (dma_channel_is_busy(a->dma_channel)) return true;
 
-    ch = toupper(ch);
-    int font_idx = GetFontIndex(ch);
+    i2c_hw_t *hw = i2c_get_hw(dev->config.i2c);
+    bool aborted = hw->raw_intr_stat & I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS;
 
-    for (int col = 0; col < 8; col++) {
-        uint8_t col_data = font[font_idx * 8 + col];
-        for (int row = 0; row < 8; row++) {
-            if (col_data & (1 << row)) {
-                ssd1306_set_pixel(dev, buf, x + col, y + row, true);
-            }
+    if (!aborted) {
+        // The controller holds SCL while the FIFO is empty, so a late poll
+        // only stretches the transfer; it never splits it.
+        if (a->next_page <= a->end_page) {
+            async_stage_next_page(dev);
+            return true;
+        }
+        // Last words still draining from the FIFO
+        if (!(hw->status & I2C_IC_STATUS_TFE_BITS) ||
+            (hw->status & I2C_IC_STATUS_MST_ACTIVITY_BITS)) {
+            return true;
+        }
+    } else {
+        (void)hw->clr_tx_abrt;
+        if (dev->gfx.shadow) {
+            // The shadow already holds pages that never arrived
+            oled_shadow_invalidate(&dev->gfx);
+        } else if (oled_is_transposed(&dev->gfx)) {
+            // Panel pages span every canvas page when rotated
+            oled_mark_all_dirty(&dev->gfx);
+        } else {
+            ssd1306_mark_dirty(dev, 0, a->start_page * SSD1306_PAGE_HEIGHT,
+                               dev->gfx.width - 1, (a->end_page + 1) * SSD1306_PAGE_HEIGHT - 1);
         }
     }
+
+    dev->gfx.busy = false;
+    if (a->callback) a->callback(a->user_data, !aborted);
+    return false;
 }
 
-void ssd1306_write_string(ssd1306_t *dev, uint8_t *buf, int16_t x, int16_t y, const char *str) {
-    while (*str && x <= SSD1306_WIDTH - 8) {
-        ssd1306_write_char(dev, buf, x, y, (uint8_t)*str++);
-        x += 8;
+void ssd1306_render_async_wait(ssd1306_t *dev) {
+    while (ssd1306_render_async_poll(dev)) {
+        tight_loop_contents();
     }
 }
-
-void ssd1306_write_centered(ssd1306_t *dev, uint8_t *buf, int16_t y, const char *str) {
-    int16_t x = (SSD1306_WIDTH - (int16_t)(strlen(str) * 8)) / 2;
-    if (x < 0) x = 0;
-    ssd1306_write_string(dev, buf, x, y, str);
-}
\ No newline at end of file